@@ -46,6 +46,7 @@ STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_ORIGINAL_PACKET_CNT, "rpc stream compress
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_COMPRESSED_PACKET_CNT, "rpc stream compress compressed packet cnt", ObStatClassIds::NETWORK, 10017, false, true, true)
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_ORIGINAL_SIZE, "rpc stream compress original size", ObStatClassIds::NETWORK, 10018, false, true, true)
 STAT_EVENT_ADD_DEF(RPC_STREAM_COMPRESS_COMPRESSED_SIZE, "rpc stream compress compressed size", ObStatClassIds::NETWORK, 10019, false, true, true)
+STAT_EVENT_ADD_DEF(MYSQL_PACKET_OUT_COPY_BYTES, "mysql packet out copy bytes", ObStatClassIds::NETWORK, 10020, false, true, true)
 
 // QUEUE
 STAT_EVENT_ADD_DEF(REQUEST_QUEUED_COUNT, "REQUEST_QUEUED_COUNT", QUEUE, "REQUEST_QUEUED_COUNT", true, true, false)
@@ -197,6 +198,9 @@ STAT_EVENT_ADD_DEF(SQL_LOCAL_TIME, "sql local execute time", ObStatClassIds::SQL
 STAT_EVENT_ADD_DEF(SQL_REMOTE_TIME, "sql remote execute time", ObStatClassIds::SQL, 40117, false, true, true)
 STAT_EVENT_ADD_DEF(SQL_DISTRIBUTED_TIME, "sql distributed execute time", ObStatClassIds::SQL, 40118, false, true, true)
 STAT_EVENT_ADD_DEF(SQL_FAIL_COUNT, "sql fail count", ObStatClassIds::SQL, 40119, false, true, true)
+STAT_EVENT_ADD_DEF(DAS_REMOTE_RPC_COUNT, "das remote rpc count", ObStatClassIds::SQL, 40120, false, true, true)
+STAT_EVENT_ADD_DEF(DAS_REMOTE_TASK_COUNT, "das remote task count", ObStatClassIds::SQL, 40121, false, true, true)
+STAT_EVENT_ADD_DEF(DAS_REMOTE_WAIT_TIME, "das remote wait time", ObStatClassIds::SQL, 40122, false, true, true)
 
 // CACHE
 STAT_EVENT_ADD_DEF(ROW_CACHE_HIT, "row cache hit", ObStatClassIds::CACHE, 50000, true, true, true)
@@ -344,6 +348,10 @@ STAT_EVENT_ADD_DEF(PUSHDOWN_STORAGE_FILTER_ROW_CNT, "storage filtered row count"
 STAT_EVENT_ADD_DEF(MINOR_SSSTORE_READ_ROW_COUNT, "minor ssstore read row count", ObStatClassIds::STORAGE, 60091, true, true, true)
 STAT_EVENT_ADD_DEF(MAJOR_SSSTORE_READ_ROW_COUNT, "major ssstore read row count", ObStatClassIds::STORAGE, 60092, true, true, true)
 STAT_EVENT_ADD_DEF(STORAGE_WRITING_THROTTLE_TIME, "storage waiting throttle time", ObStatClassIds::STORAGE, 60093, true, true, true)
+STAT_EVENT_ADD_DEF(SKIP_INDEX_CHECK_BLOCK_CNT, "skip index check block count", ObStatClassIds::STORAGE, 60094, true, true, true)
+STAT_EVENT_ADD_DEF(SKIP_INDEX_SKIPPED_BLOCK_CNT, "skip index skipped block count", ObStatClassIds::STORAGE, 60095, true, true, true)
+STAT_EVENT_ADD_DEF(MEMSTORE_TRANS_END_CLEANOUT_COUNT, "memstore trans end cleanout callback count", ObStatClassIds::STORAGE, 60096, false, true, true)
+STAT_EVENT_ADD_DEF(MEMSTORE_TRANS_END_TIME, "memstore trans end time", ObStatClassIds::STORAGE, 60097, false, true, true)
 
 // backup & restore
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_COUNT, "backup io read count", ObStatClassIds::STORAGE, 69000, true, true, true)
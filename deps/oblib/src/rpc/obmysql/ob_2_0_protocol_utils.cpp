@@ -45,6 +45,7 @@ inline int ObProtoEncodeParam::save_large_packet(const char *start, const int64_
     LOG_ERROR("fail to alloc mem", K(len), K(ret));
   } else {
     MEMCPY(large_pkt_buf_, start, len);
+    EVENT_ADD(MYSQL_PACKET_OUT_COPY_BYTES, len);
     large_pkt_buf_len_ = len;
     large_pkt_buf_pos_ = 0;
   }
@@ -161,6 +162,8 @@ inline int ObProto20Utils::do_proto20_packet_encode(ObProtoEncodeParam &param)
         } else {
           // reserve header
           easy_buffer.write(proto20_context.header_len_);
+          proto20_context.payload_crc64_ = 0;
+          proto20_context.crc_payload_len_ = 0;
           proto20_context.next_step_ = FILL_PAYLOAD_STEP;
         }
         break;
@@ -381,10 +384,12 @@ inline int ObProto20Utils::fill_proto20_payload(ObProtoEncodeParam &param, bool
       LOG_ERROR("invalid len", K(handle_len), K(ObProtoEncodeParam::MAX_PROTO20_PAYLOAD_LEN), K(ret));
     } else {
       MEMCPY(easy_buffer.last(), param.get_start(), handle_len);
+      EVENT_ADD(MYSQL_PACKET_OUT_COPY_BYTES, handle_len);
       if (OB_FAIL(param.add_pos(handle_len))) {
         LOG_ERROR("fail to add_pos", K(handle_len), K(ret));
       } else {
         easy_buffer.write(handle_len);
+        update_proto20_payload_crc(param);
         if (!param.is_large_packet_cached_avail()) {
           // this means the large packet has encode complete
           need_break = true;  // wait to encode next one
@@ -462,6 +467,7 @@ inline int ObProto20Utils::fill_proto20_payload(ObProtoEncodeParam &param, bool
     if (is_buffer_enough) {
       if (1 == split_count) {
         easy_buffer.write(seri_size);
+        update_proto20_payload_crc(param);
         param.is_pkt_encoded_ = true;
         // noting break, wait to encode next one
         if (param.conn_->pkt_rec_wrapper_.enable_proto_dia()) {
@@ -476,6 +482,7 @@ inline int ObProto20Utils::fill_proto20_payload(ObProtoEncodeParam &param, bool
             // this means some data already in buff, make it to be a proto20 packet
           } else {
             easy_buffer.write(ObProtoEncodeParam::PROTO20_SPLIT_LEN);
+            update_proto20_payload_crc(param);
             if (OB_FAIL(param.add_pos(ObProtoEncodeParam::PROTO20_SPLIT_LEN))) {
               LOG_ERROR("fail to add pos", K(ObProtoEncodeParam::PROTO20_SPLIT_LEN), K(ret));
             }
@@ -520,11 +527,11 @@ inline int ObProto20Utils::fill_proto20_tailer(ObProtoEncodeParam &param) {
               "tailer len", proto20_context.tailer_len_, K(ret));
   } else {
     int64_t pos = 0;
-    char *start = easy_buffer.begin() + proto20_context.header_len_;
-    int64_t len = easy_buffer.read_avail_size() - proto20_context.header_len_;
     uint64_t crc64 = 0;
     if (!proto20_context.is_checksum_off_) {
-      crc64 = ob_crc64(start, len);
+      // only the bytes not covered by the incremental crc are checksummed here
+      update_proto20_payload_crc(param);
+      crc64 = proto20_context.payload_crc64_;
     }
     if (OB_FAIL(ObMySQLUtil::store_int4(easy_buffer.last(), proto20_context.tailer_len_, (int32_t)(crc64), pos))) {
       LOG_ERROR("fail to store int4", K(ret));
@@ -615,6 +622,24 @@ inline int ObProto20Utils::fill_proto20_header(ObProtoEncodeParam &param) {
   return ret;
 }
 
+// Fold the payload bytes appended since the last call into the running crc64, while
+// they are still hot in cache.
+inline void ObProto20Utils::update_proto20_payload_crc(ObProtoEncodeParam &param)
+{
+  ObProto20Context &proto20_context = *param.proto20_context_;
+  if (!proto20_context.is_checksum_off_) {
+    ObEasyBuffer easy_buffer(*param.ez_buf_);
+    const int64_t checked_len = proto20_context.header_len_ + proto20_context.crc_payload_len_;
+    const int64_t len = easy_buffer.read_avail_size() - checked_len;
+    if (len > 0) {
+      proto20_context.payload_crc64_ = ob_crc64(proto20_context.payload_crc64_,
+                                                easy_buffer.begin() + checked_len,
+                                                len);
+      proto20_context.crc_payload_len_ += len;
+    }
+  }
+}
+
 inline bool ObProto20Utils::is_the_last_packet(const ObProtoEncodeParam &param)
 {
   bool bret = false;
@@ -68,7 +68,7 @@ public:
       is_proto20_used_(false), is_checksum_off_(false),
       has_extra_info_(false), is_new_extra_info_(false),
       curr_proto20_packet_start_pos_(0), txn_free_route_(false),
-      is_filename_packet_(false) {}
+      is_filename_packet_(false), payload_crc64_(0), crc_payload_len_(0) {}
   ~ObProto20Context() {}
 
   inline void reset() { MEMSET(this, 0, sizeof(ObProto20Context)); }
@@ -86,7 +86,9 @@ public:
                 K_(is_new_extra_info),
                 K_(txn_free_route),
                 K_(curr_proto20_packet_start_pos),
-                K_(is_filename_packet));
+                K_(is_filename_packet),
+                K_(payload_crc64),
+                K_(crc_payload_len));
 
 public:
   uint8_t comp_seq_;
@@ -104,6 +106,10 @@ public:
   // used in local local.
   // We should set `is_filename_packet_` when sending PKT_FILENAME packet.
   bool is_filename_packet_;
+  // crc64 of the payload of the proto20 packet being filled, accumulated while the
+  // mysql packets are appended so that the tailer does not need a second pass.
+  uint64_t payload_crc64_;
+  int64_t crc_payload_len_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObProto20Context);
 };
@@ -222,6 +228,7 @@ private:
   inline static int fill_proto20_payload(ObProtoEncodeParam &param, bool &is_break);
   inline static int fill_proto20_tailer(ObProtoEncodeParam &param);
   inline static int fill_proto20_header(ObProtoEncodeParam &param);
+  inline static void update_proto20_payload_crc(ObProtoEncodeParam &param);
   inline static bool is_the_last_packet(const ObProtoEncodeParam &param);
   inline static bool has_extra_info(const ObProtoEncodeParam &param);
   static int reset_extra_info(ObProtoEncodeParam &param);
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/checksum/ob_crc64.h"
+#include "rpc/ob_request.h"
+#include "rpc/obmysql/ob_mysql_util.h"
+#include "rpc/obmysql/ob_2_0_protocol_utils.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::rpc;
+using namespace oceanbase::obmysql;
+using namespace oceanbase::observer;
+
+class ObFakeMySQLPacket : public ObMySQLPacket
+{
+public:
+  ObFakeMySQLPacket() : content_len_(0), fill_(0) {}
+  int64_t content_len_;
+  char fill_;
+protected:
+  virtual int serialize(char *start, const int64_t len, int64_t &pos) const
+  {
+    int ret = OB_SUCCESS;
+    if ((NULL == start) || (content_len_ < 0)) {
+      ret = OB_INVALID_ARGUMENT;
+    } else if ((len - pos) < content_len_) {
+      ret = OB_BUF_NOT_ENOUGH;
+    } else {
+      for (int64_t i = 0; i < content_len_; i++) {
+        start[pos + i] = static_cast<char>(fill_ + i % 31);
+      }
+      pos += content_len_;
+    }
+    return ret;
+  }
+};
+
+class TestProto20Utils : public ::testing::Test
+{
+public:
+  static const int64_t HEADER_LEN = OB20_PROTOCOL_HEADER_LENGTH + OB_MYSQL_COMPRESSED_HEADER_SIZE;
+  static const int64_t TAILER_LEN = OB20_PROTOCOL_TAILER_LENGTH;
+  // offset of the payload length in the ob20 header: compressed header(7), magic num(2),
+  // version(2), connection id(4), request id(3) and packet seq(1)
+  static const int64_t PAYLOAD_LEN_OFFSET = OB_MYSQL_COMPRESSED_HEADER_SIZE + 12;
+
+  TestProto20Utils() : req_(ObRequest::OB_MYSQL), buf_(NULL), buf_len_(0) {}
+
+  virtual void SetUp()
+  {
+    buf_len_ = 24 * 1024 * 1024;
+    buf_ = static_cast<char *>(ob_malloc(buf_len_, "TestProto20"));
+    ASSERT_NE(nullptr, buf_);
+    MEMSET(&ez_buf_, 0, sizeof(ez_buf_));
+    ez_buf_.data = buf_;
+    ez_buf_.pos = buf_;
+    ez_buf_.last = buf_;
+    ez_buf_.end = buf_ + buf_len_;
+    proto20_context_.is_proto20_used_ = true;
+    proto20_context_.header_len_ = HEADER_LEN;
+    proto20_context_.tailer_len_ = TAILER_LEN;
+  }
+
+  virtual void TearDown()
+  {
+    ob_free(buf_);
+    buf_ = NULL;
+  }
+
+  void build_param(ObProtoEncodeParam &param, ObMySQLPacket *pkt, const bool is_last)
+  {
+    param.proto20_context_ = &proto20_context_;
+    param.ez_buf_ = &ez_buf_;
+    param.pkt_ = pkt;
+    param.is_last_ = is_last;
+    param.conn_id_ = 1;
+    param.req_ = &req_;
+    param.conn_ = &conn_;
+  }
+
+  // encode the packets into one ob20 packet, or several ob20 packets if they are larger
+  // than the split length, like ObMPPacketSender does
+  void encode(ObFakeMySQLPacket *pkts, const int64_t pkt_cnt)
+  {
+    for (int64_t i = 0; i < pkt_cnt; ++i) {
+      ObProtoEncodeParam param;
+      build_param(param, &pkts[i], false);
+      ASSERT_EQ(OB_SUCCESS, ObProto20Utils::do_packet_encode(param));
+      ASSERT_EQ(OB_SUCCESS, param.encode_ret_);
+      ASSERT_TRUE(param.is_pkt_encoded_);
+    }
+    ObProtoEncodeParam param;
+    build_param(param, NULL, true);
+    ASSERT_EQ(OB_SUCCESS, ObProto20Utils::fill_proto20_header_and_tailer(param));
+  }
+
+  // check the tailer of every ob20 packet in buffer against the crc64 of its whole payload
+  void check_crc(const int64_t expect_payload_len, const int64_t expect_packet_cnt)
+  {
+    int64_t pos = 0;
+    int64_t payload_len_sum = 0;
+    int64_t packet_cnt = 0;
+    const int64_t total_len = ez_buf_.last - ez_buf_.pos;
+    while (pos < total_len) {
+      const char *payload_len_pos = ez_buf_.pos + pos + PAYLOAD_LEN_OFFSET;
+      uint32_t payload_len = 0;
+      ObMySQLUtil::get_uint4(payload_len_pos, payload_len);
+      ASSERT_LE(pos + HEADER_LEN + payload_len + TAILER_LEN, total_len);
+      const char *payload = ez_buf_.pos + pos + HEADER_LEN;
+      const char *tailer_pos = payload + payload_len;
+      uint32_t crc = 0;
+      ObMySQLUtil::get_uint4(tailer_pos, crc);
+      const uint32_t expect_crc = proto20_context_.is_checksum_off_ ?
+                                  0 : static_cast<uint32_t>(ob_crc64(payload, payload_len));
+      ASSERT_EQ(expect_crc, crc) << "ob20 packet idx: " << packet_cnt;
+      payload_len_sum += payload_len;
+      pos += HEADER_LEN + payload_len + TAILER_LEN;
+      ++packet_cnt;
+    }
+    ASSERT_EQ(total_len, pos);
+    ASSERT_EQ(expect_payload_len, payload_len_sum);
+    ASSERT_EQ(expect_packet_cnt, packet_cnt);
+  }
+
+public:
+  ObRequest req_;
+  ObSMConnection conn_;
+  ObProto20Context proto20_context_;
+  easy_buf_t ez_buf_;
+  char *buf_;
+  int64_t buf_len_;
+};
+
+TEST_F(TestProto20Utils, crc_of_several_packets)
+{
+  // the crc is accumulated as each mysql packet is appended
+  const int64_t PKT_CNT = 5;
+  ObFakeMySQLPacket pkts[PKT_CNT];
+  int64_t payload_len = 0;
+  for (int64_t i = 0; i < PKT_CNT; ++i) {
+    pkts[i].content_len_ = 100 * (i + 1) + i;
+    pkts[i].fill_ = static_cast<char>('a' + i);
+    payload_len += OB_MYSQL_HEADER_LENGTH + pkts[i].content_len_;
+  }
+  encode(pkts, PKT_CNT);
+  check_crc(payload_len, 1);
+}
+
+TEST_F(TestProto20Utils, crc_of_split_large_packet)
+{
+  // the large packet is copied out and split into several ob20 packets, each of them has
+  // its own crc
+  const int64_t PKT_CNT = 1;
+  ObFakeMySQLPacket pkts[PKT_CNT];
+  pkts[0].content_len_ = ObProtoEncodeParam::PROTO20_SPLIT_LEN + 1024 * 1024;
+  pkts[0].fill_ = 'a';
+  encode(pkts, PKT_CNT);
+  check_crc(OB_MYSQL_HEADER_LENGTH + pkts[0].content_len_, 2);
+}
+
+TEST_F(TestProto20Utils, checksum_off)
+{
+  const int64_t PKT_CNT = 3;
+  ObFakeMySQLPacket pkts[PKT_CNT];
+  int64_t payload_len = 0;
+  proto20_context_.is_checksum_off_ = true;
+  for (int64_t i = 0; i < PKT_CNT; ++i) {
+    pkts[i].content_len_ = 64;
+    pkts[i].fill_ = 'a';
+    payload_len += OB_MYSQL_HEADER_LENGTH + pkts[i].content_len_;
+  }
+  encode(pkts, PKT_CNT);
+  check_crc(payload_len, 1);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
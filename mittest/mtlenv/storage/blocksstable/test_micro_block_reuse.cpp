@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2024 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+
+#include "storage/compaction/ob_index_block_micro_iterator.h"
+#include "ob_index_block_data_prepare.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace compaction;
+
+namespace blocksstable
+{
+
+class TestMicroBlockReuse : public TestIndexBlockDataPrepare
+{
+public:
+  TestMicroBlockReuse();
+  virtual ~TestMicroBlockReuse() {}
+  static void SetUpTestCase();
+  static void TearDownTestCase();
+
+  virtual void SetUp();
+  virtual void TearDown();
+
+  // rewrite the first macro block of sstable_ like a major merge: the first micro block is dirty and
+  // only its first @pending_row_cnt rows are left (all the rows if it is negative), the others are
+  // unchanged and appended as micro blocks
+  void rewrite_first_macro_block(
+      const int64_t pending_row_cnt,
+      int64_t &micro_block_size,
+      ObIArray<ObMicroBlockHeader> &origin_headers,
+      ObIArray<ObMicroBlockHeader> &new_headers);
+};
+
+TestMicroBlockReuse::TestMicroBlockReuse()
+  : TestIndexBlockDataPrepare("Test micro block reuse", MAJOR_MERGE, false, OB_DEFAULT_MACRO_BLOCK_SIZE,
+                              10000, 10000, FLAT_ROW_STORE)
+{
+}
+
+void TestMicroBlockReuse::SetUpTestCase()
+{
+  TestIndexBlockDataPrepare::SetUpTestCase();
+}
+
+void TestMicroBlockReuse::TearDownTestCase()
+{
+  TestIndexBlockDataPrepare::TearDownTestCase();
+}
+
+void TestMicroBlockReuse::SetUp()
+{
+  TestIndexBlockDataPrepare::SetUp();
+  ObLSID ls_id(ls_id_);
+  ObTabletID tablet_id(tablet_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  ASSERT_EQ(OB_SUCCESS, ls_handle.get_ls()->get_tablet(tablet_id, tablet_handle_));
+}
+
+void TestMicroBlockReuse::TearDown()
+{
+  tablet_handle_.reset();
+  TestIndexBlockDataPrepare::TearDown();
+}
+
+void TestMicroBlockReuse::rewrite_first_macro_block(
+    const int64_t pending_row_cnt,
+    int64_t &micro_block_size,
+    ObIArray<ObMicroBlockHeader> &origin_headers,
+    ObIArray<ObMicroBlockHeader> &new_headers)
+{
+  const ObITableReadInfo &rowkey_read_info = tablet_handle_.get_obj()->get_rowkey_read_info();
+  ObDatumRange range;
+  range.set_whole_range();
+  ObIMacroBlockIterator *macro_iter = nullptr;
+  ObDataMacroBlockMeta macro_meta;
+  ObMacroBlockDesc macro_desc;
+  macro_desc.macro_meta_ = &macro_meta;
+  OK(sstable_.scan_macro_block(range, rowkey_read_info, allocator_, macro_iter, false, true, true));
+  OK(macro_iter->get_next_macro_block(macro_desc));
+  ObIndexBlockMicroIterator micro_iter;
+  OK(micro_iter.init(macro_desc, rowkey_read_info, macro_iter->get_micro_index_infos(),
+      macro_iter->get_micro_endkeys(), static_cast<ObRowStoreType>(macro_desc.row_store_type_), &sstable_));
+
+  share::SCN scn;
+  scn.convert_for_tx(SNAPSHOT_VERSION);
+  ObWholeDataStoreDesc desc;
+  OK(desc.init(table_schema_, ObLSID(ls_id_), ObTabletID(tablet_id_), merge_type_, SNAPSHOT_VERSION,
+               DATA_CURRENT_VERSION, scn));
+  desc.get_desc().static_desc_->schema_version_ = 10;
+  ObSSTableIndexBuilder sstable_builder;
+  desc.get_desc().sstable_index_builder_ = &sstable_builder;
+  OK(sstable_builder.init(desc.get_desc()));
+  ObMacroDataSeq start_seq(0);
+  start_seq.set_data_block();
+  ObMacroBlockWriter writer;
+  OK(writer.open(desc.get_desc(), start_seq));
+  micro_block_size = desc.get_desc().get_micro_block_size();
+
+  const ObMicroBlock *micro_block = nullptr;
+  OK(micro_iter.next(micro_block));
+  OK(origin_headers.push_back(micro_block->header_));
+  const int64_t row_cnt = pending_row_cnt < 0 ? micro_block->header_.row_count_ : pending_row_cnt;
+  ASSERT_LE(row_cnt, micro_block->header_.row_count_);
+
+  ObDatumRow row;
+  ObDatumRow multi_row;
+  OK(row.init(allocator_, MAX_TEST_COLUMN_CNT));
+  OK(multi_row.init(allocator_, MAX_TEST_COLUMN_CNT));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    OK(row_generate_.get_next_row(min_row_seed_ + i, row));
+    convert_to_multi_version_row(row, table_schema_, SNAPSHOT_VERSION, DF_INSERT, multi_row);
+    OK(writer.append_row(multi_row));
+  }
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(micro_iter.next(micro_block))) {
+    OK(origin_headers.push_back(micro_block->header_));
+    OK(writer.append_micro_block(*micro_block, &macro_desc));
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+  if (writer.micro_writer_->get_row_count() > 0) {
+    OK(writer.build_micro_block());
+  }
+
+  // all the micro blocks are in the first new macro block
+  ObMacroBlock &macro_block = writer.macro_blocks_[writer.current_index_];
+  const char *buf = macro_block.get_micro_block_data_ptr();
+  const int64_t buf_size = macro_block.get_micro_block_data_size();
+  int64_t pos = 0;
+  while (pos < buf_size) {
+    ObMicroBlockHeader header;
+    int64_t header_pos = 0;
+    OK(header.deserialize(buf + pos, buf_size - pos, header_pos));
+    OK(new_headers.push_back(header));
+    pos += header.header_size_ + header.data_zlength_;
+  }
+  ASSERT_EQ(buf_size, pos);
+  ASSERT_EQ(macro_block.get_micro_block_count(), new_headers.count());
+
+  OK(writer.close());
+  ObSSTableMergeRes res;
+  OK(sstable_builder.close(res));
+  macro_iter->~ObIMacroBlockIterator();
+}
+
+TEST_F(TestMicroBlockReuse, test_reuse_after_tiny_pending_rows)
+{
+  int64_t micro_block_size = 0;
+  ObArray<ObMicroBlockHeader> origin_headers;
+  ObArray<ObMicroBlockHeader> new_headers;
+  rewrite_first_macro_block(1, micro_block_size, origin_headers, new_headers);
+  ASSERT_GT(origin_headers.count(), 3);
+  for (int64_t i = 1; i < origin_headers.count() - 1; ++i) {
+    ASSERT_GT(origin_headers.at(i).data_length_, micro_block_size / 2);
+  }
+
+  // the single pending row is merged with the second micro block instead of being left as a tiny
+  // micro block, and the following micro blocks are reused
+  ASSERT_EQ(origin_headers.count() - 1, new_headers.count());
+  ASSERT_EQ(1 + origin_headers.at(1).row_count_, new_headers.at(0).row_count_);
+  for (int64_t i = 1; i < new_headers.count(); ++i) {
+    ASSERT_EQ(origin_headers.at(i + 1).row_count_, new_headers.at(i).row_count_);
+    ASSERT_EQ(origin_headers.at(i + 1).data_length_, new_headers.at(i).data_length_);
+  }
+  for (int64_t i = 0; i < new_headers.count() - 1; ++i) {
+    ASSERT_GE(new_headers.at(i).data_length_, micro_block_size / 4) << "micro block idx: " << i;
+  }
+}
+
+TEST_F(TestMicroBlockReuse, test_reuse_after_big_pending_rows)
+{
+  int64_t micro_block_size = 0;
+  ObArray<ObMicroBlockHeader> origin_headers;
+  ObArray<ObMicroBlockHeader> new_headers;
+  // keep all the rows of the dirty micro block
+  rewrite_first_macro_block(-1, micro_block_size, origin_headers, new_headers);
+  ASSERT_GT(origin_headers.count(), 3);
+
+  // the pending rows are built to their own micro block, all the following micro blocks are reused
+  ASSERT_EQ(origin_headers.count(), new_headers.count());
+  for (int64_t i = 0; i < new_headers.count(); ++i) {
+    ASSERT_EQ(origin_headers.at(i).row_count_, new_headers.at(i).row_count_);
+  }
+  for (int64_t i = 0; i < new_headers.count() - 1; ++i) {
+    ASSERT_GE(new_headers.at(i).data_length_, micro_block_size / 4) << "micro block idx: " << i;
+  }
+}
+
+} // end blocksstable
+} // end oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_reuse.log*");
+  OB_LOGGER.set_file_name("test_micro_block_reuse.log", true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -2950,6 +2950,132 @@ TEST_F(TestMemtableV2, test_compact_v3)
   fmemtable->destroy();
 }
 
+TEST_F(TestMemtableV2, test_compact_hot_row_on_read)
+{
+  ObMemtable *memtable = create_memtable();
+  const int64_t node_cnt = ObMvccRow::HOT_ROW_COMPACT_NODE_CNT + 6;
+
+  TRANS_LOG(INFO, "######## CASE1: txns update one row and commit without compaction");
+  ObMvccRow *row = NULL;
+  for (int64_t i = 0; i < node_cnt; i++) {
+    ObDatumRowkey rowkey;
+    ObStoreRow write_row;
+    EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                   i, /*value*/
+                                   rowkey,
+                                   write_row));
+    ObStoreCtx *wtx = start_tx(ObTransID(i + 1));
+    write_tx(wtx,
+             memtable,
+             1000 + 10 * i + 1, /*snapshot version*/
+             write_row);
+    if (NULL == row) {
+      row = get_tx_last_mvcc_row(wtx);
+    }
+    // keep the commit from compacting the row
+    row->update_since_compact_ = 0;
+    commit_txn(wtx,
+               1000 + 10 * i + 5,/*commit_version*/
+               true /*need_write_back*/);
+  }
+  ASSERT_NE(NULL, (long)row);
+  EXPECT_EQ(NULL, row->latest_compact_node_);
+  const int64_t head_modify_cnt = row->list_head_->modify_count_;
+  EXPECT_EQ(node_cnt - 1, head_modify_cnt);
+
+  ObDatumRowkey rowkey;
+  ObStoreRow read_key_row;
+  EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                 node_cnt - 1, /*value*/
+                                 rowkey,
+                                 read_key_row));
+  const int64_t read_snapshot = 1000 + 10 * node_cnt + 100;
+
+  TRANS_LOG(INFO, "######## CASE2: read does not compact a short chain inside the compact interval");
+  row->latest_compact_ts_ = ObTimeUtility::current_time();
+  row->last_compact_cnt_ = head_modify_cnt - (ObMvccRow::HOT_ROW_COMPACT_NODE_CNT - 1);
+  row->update_since_compact_ = ObServerConfig::get_instance().row_compaction_update_limit * 3;
+  read_row(memtable,
+           rowkey,
+           read_snapshot, /*snapshot version*/
+           1,             /*key*/
+           node_cnt - 1   /*value*/);
+  EXPECT_EQ(0, row->update_since_compact_);
+  EXPECT_EQ(NULL, row->latest_compact_node_);
+  EXPECT_EQ(head_modify_cnt - (ObMvccRow::HOT_ROW_COMPACT_NODE_CNT - 1), row->last_compact_cnt_);
+
+  TRANS_LOG(INFO, "######## CASE3: read compacts a hot row inside the compact interval");
+  row->latest_compact_ts_ = ObTimeUtility::current_time();
+  row->last_compact_cnt_ = head_modify_cnt - ObMvccRow::HOT_ROW_COMPACT_NODE_CNT;
+  row->update_since_compact_ = ObServerConfig::get_instance().row_compaction_update_limit * 3;
+  EXPECT_EQ(ObMvccRow::HOT_ROW_COMPACT_NODE_CNT, row->get_uncompacted_node_cnt());
+  read_row(memtable,
+           rowkey,
+           read_snapshot, /*snapshot version*/
+           1,             /*key*/
+           node_cnt - 1   /*value*/);
+  EXPECT_EQ(0, row->update_since_compact_);
+  EXPECT_NE(NULL, (long)row->latest_compact_node_);
+  EXPECT_EQ(head_modify_cnt, row->last_compact_cnt_);
+  EXPECT_EQ(0, row->get_uncompacted_node_cnt());
+  read_row(memtable,
+           rowkey,
+           read_snapshot, /*snapshot version*/
+           1,             /*key*/
+           node_cnt - 1   /*value*/);
+
+  memtable->destroy();
+}
+
+TEST_F(TestMemtableV2, test_foreign_key_check_with_row_compact)
+{
+  ObMemtable *memtable = create_memtable();
+
+  TRANS_LOG(INFO, "######## CASE1: txn1 write row and commit");
+  ObDatumRowkey rowkey;
+  ObStoreRow write_row;
+  EXPECT_EQ(OB_SUCCESS, mock_row(1, /*key*/
+                                 2, /*value*/
+                                 rowkey,
+                                 write_row));
+
+  ObTransID write_tx_id = ObTransID(1);
+  ObStoreCtx *wtx = start_tx(write_tx_id);
+  write_tx(wtx,
+           memtable,
+           1000, /*snapshot version*/
+           write_row);
+  ObMvccRow *row = get_tx_last_mvcc_row(wtx);
+  commit_txn(wtx,
+             2000,/*commit_version*/
+             true /*need_write_back*/);
+
+  TRANS_LOG(INFO, "######## CASE2: foreign key check meets tsc even if the read compacts the row");
+  // make the read below trigger row compaction
+  row->update_since_compact_ = ObServerConfig::get_instance().row_compaction_update_limit * 3;
+  query_flag_.set_for_foreign_key_check();
+  read_row(memtable,
+           rowkey,
+           1500,   /*snapshot version*/
+           1,      /*key*/
+           2,      /*value*/
+           false,  /*exist*/
+           OB_TRANSACTION_SET_VIOLATION);
+  EXPECT_EQ(0, row->update_since_compact_);
+
+  TRANS_LOG(INFO, "######## CASE3: foreign key check passes with a newer snapshot");
+  row->update_since_compact_ = ObServerConfig::get_instance().row_compaction_update_limit * 3;
+  read_row(memtable,
+           rowkey,
+           2500,   /*snapshot version*/
+           1,      /*key*/
+           2       /*value*/);
+  EXPECT_EQ(0, row->update_since_compact_);
+  query_flag_.for_foreign_key_check_ = false;
+
+  memtable->destroy();
+}
+
 TEST_F(TestMemtableV2, test_dml_flag)
 {
   ObMemtable *lmemtable = create_memtable();
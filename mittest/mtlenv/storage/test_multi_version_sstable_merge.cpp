@@ -65,6 +65,7 @@ namespace storage
 {
 
 ObSEArray<ObTxData, 8> TX_DATA_ARR;
+int64_t CHECK_TX_DATA_CNT = 0;
 
 int ObTxTable::insert(ObTxData *&tx_data)
 {
@@ -76,6 +77,7 @@ int ObTxTable::insert(ObTxData *&tx_data)
 int ObTxTable::check_with_tx_data(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn)
 {
   int ret = OB_SUCCESS;
+  ++CHECK_TX_DATA_CNT;
   for (int i = 0; i < TX_DATA_ARR.count(); i++)
   {
     if (read_tx_data_arg.tx_id_ == TX_DATA_ARR.at(i).tx_id_) {
@@ -3395,6 +3397,101 @@ TEST_F(TestMultiVersionMerge, test_running_trans_cross_macro_with_abort_sql_seq)
   merger.reset();
 }
 
+TEST_F(TestMultiVersionMerge, test_lock_for_read_of_same_trans_in_query)
+{
+  int ret = OB_SUCCESS;
+  ObTableHandleV2 handle;
+  const char *micro_data[2];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "1        var1  MIN      -3       1       NOP     EXIST   ULF  trans_id_1\n"
+      "2        var2  MIN      -10      2       NOP     EXIST   ULF  trans_id_1\n";
+
+  micro_data[1] =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag trans_id\n"
+      "3        var3  MIN      -10      3       NOP     EXIST   ULF  trans_id_1\n"
+      "4        var4  MIN      -3       4       NOP     EXIST   ULF  trans_id_1\n"
+      "5        var5  MIN      -3       5       NOP     EXIST   ULF  trans_id_1\n";
+
+  int schema_rowkey_cnt = 2;
+  int64_t snapshot_version = 10;
+  ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(10);
+  prepare_table_schema(micro_data, schema_rowkey_cnt, scn_range, snapshot_version);
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data, 2, INT64_MAX, true);
+  prepare_data_end(handle);
+
+  ObLSID ls_id(ls_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  ObTxTable *tx_table = nullptr;
+  ObTxTableGuard tx_table_guard;
+  ls_handle.get_ls()->get_tx_table_guard(tx_table_guard);
+  ASSERT_NE(nullptr, tx_table = tx_table_guard.get_tx_table());
+
+  transaction::ObTransID tx_id = 1;
+  ObTxData *tx_data = new ObTxData();
+  tx_data->tx_id_ = tx_id;
+  tx_data->commit_version_.convert_for_tx(INT64_MAX);
+  tx_data->start_scn_.convert_for_tx(1);
+  tx_data->end_scn_.convert_for_tx(30);
+  tx_data->state_ = ObTxData::RUNNING;
+  ASSERT_EQ(OB_SUCCESS, tx_table->insert(tx_data));
+  delete tx_data;
+
+  ObVersionRange trans_version_range;
+  trans_version_range.snapshot_version_ = INT64_MAX;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.base_version_ = 1;
+  prepare_query_param(trans_version_range);
+  // query scan with ObMultiVersionMicroBlockRowScanner instead of the whole scanner of merge
+  context_.query_flag_.daily_merge_ = 0;
+  context_.query_flag_.whole_macro_scan_ = 0;
+  // the rows are read by their own txn, the rows with sequence 3 are visible and the rows with
+  // sequence 10 are not
+  store_ctx_.mvcc_acc_ctx_.snapshot_.tx_id_ = tx_id;
+  store_ctx_.mvcc_acc_ctx_.snapshot_.scn_ = ObTxSEQ::mk_v0(5);
+
+  ObSSTable *sstable = nullptr;
+  ASSERT_EQ(OB_SUCCESS, handle.get_sstable(sstable));
+  ObStoreRowIterator *scanner = nullptr;
+  ObDatumRange range;
+  range.set_whole_range();
+  for (int64_t scan_idx = 0; scan_idx < 2; ++scan_idx) {
+    if (0 == scan_idx) {
+      ASSERT_EQ(OB_SUCCESS, sstable->scan(iter_param_, context_, range, scanner));
+    } else {
+      // rescan with the reused micro scanner, the result of the last scan is not kept
+      scanner->reuse();
+      ASSERT_EQ(OB_SUCCESS, scanner->init(iter_param_, context_, sstable, &range));
+    }
+    CHECK_TX_DATA_CNT = 0;
+    const ObDatumRow *row = nullptr;
+    ObSEArray<int64_t, 8> pks;
+    while (OB_SUCC(scanner->get_next_row(row))) {
+      ASSERT_EQ(OB_SUCCESS, pks.push_back(row->storage_datums_[0].get_int()));
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+    ret = OB_SUCCESS;
+    ASSERT_EQ(3, pks.count());
+    ASSERT_EQ(1, pks.at(0));
+    ASSERT_EQ(4, pks.at(1));
+    ASSERT_EQ(5, pks.at(2));
+    // the tx table is only checked when the sequence changes: 3 and 10 in the first micro block,
+    // the sequence 10 of row 3 reuses the result across the micro blocks, then 3 again for row 4
+    ASSERT_EQ(3, CHECK_TX_DATA_CNT);
+  }
+
+  store_ctx_.mvcc_acc_ctx_.snapshot_.reset();
+  ASSERT_EQ(OB_SUCCESS, clear_tx_data());
+  scanner->~ObStoreRowIterator();
+  handle.reset();
+}
+
 }
 }
 
@@ -186,6 +186,7 @@ public:
 
   void do_print_leak_slice_test();
 
+  void do_calc_buckets_cnt_test();
 
 private:
   void insert_tx_data_();
@@ -727,6 +728,52 @@ void TestTxDataTable::do_print_leak_slice_test()
   slice_allocator.destroy();
 }
 
+void TestTxDataTable::do_calc_buckets_cnt_test()
+{
+  const int64_t MIN_CNT = ObTxDataHashMap::MIN_BUCKETS_CNT;
+  const int64_t DEFAULT_CNT = ObTxDataHashMap::DEFAULT_BUCKETS_CNT;
+  const int64_t MAX_CNT = ObTxDataHashMap::MAX_BUCKETS_CNT;
+  const int64_t HEADER_SIZE = sizeof(ObTxDataHashMap::ObTxDataHashHeader);
+  ObTxDataMemtableMgr &mgr = tx_data_table_.mgr_;
+  int64_t new_cnt = 0;
+
+  // enough memory to make sure the buckets are not limited by the tenant memory
+  const int64_t before_tenant_mem = lib::get_tenant_memory_limit(MTL_ID());
+  lib::set_tenant_memory_limit(MTL_ID(), 64LL * 1024 * 1024 * 1024 /* 64GB */);
+
+  // grow to the count which brings the load factory under the limit at once
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(0.8, DEFAULT_CNT, new_cnt));
+  ASSERT_EQ(DEFAULT_CNT << 1, new_cnt);
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(5.0, DEFAULT_CNT, new_cnt));
+  ASSERT_EQ(DEFAULT_CNT << 3, new_cnt);
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(0.7, DEFAULT_CNT, new_cnt));
+  ASSERT_EQ(DEFAULT_CNT, new_cnt);
+
+  // the growth is clamped at the max buckets cnt
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(100.0, DEFAULT_CNT, new_cnt));
+  ASSERT_EQ(MAX_CNT, new_cnt);
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(1.0, MAX_CNT, new_cnt));
+  ASSERT_EQ(MAX_CNT, new_cnt);
+
+  // shrink only one step each time and never under the min buckets cnt
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(0.01, DEFAULT_CNT, new_cnt));
+  ASSERT_EQ(DEFAULT_CNT >> 1, new_cnt);
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(0.01, MIN_CNT, new_cnt));
+  ASSERT_EQ(MIN_CNT, new_cnt);
+
+  // the buckets can use 1/16 of the remain tenant memory at most
+  const int64_t small_tenant_mem = 1LL * 1024 * 1024 * 1024; /* 1GB */
+  lib::set_tenant_memory_limit(MTL_ID(), small_tenant_mem);
+  ASSERT_EQ(OB_SUCCESS, mgr.calc_new_memtable_buckets_cnt_(100.0, DEFAULT_CNT, new_cnt));
+  ASSERT_LT(new_cnt, MAX_CNT);
+  ASSERT_GE(new_cnt, MIN_CNT);
+  if (new_cnt > MIN_CNT) {
+    ASSERT_LE(new_cnt * HEADER_SIZE, small_tenant_mem >> 4);
+  }
+
+  lib::set_tenant_memory_limit(MTL_ID(), before_tenant_mem);
+}
+
 TEST_F(TestTxDataTable, basic_test)
 {
   tx_data_num = const_data_num;
@@ -739,6 +786,8 @@ TEST_F(TestTxDataTable, undo_status_test) { do_undo_status_test(); }
 
 TEST_F(TestTxDataTable, serialize_test) { do_tx_data_serialize_test(); }
 
+TEST_F(TestTxDataTable, calc_buckets_cnt_test) { do_calc_buckets_cnt_test(); }
+
 // TEST_F(TestTxDataTable, print_leak_slice) { do_print_leak_slice_test(); }
 
 
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#include <gtest/gtest.h>
+
+#define USING_LOG_PREFIX SQL
+#define protected public
+#define private public
+
+#include "env/ob_simple_cluster_test_base.h"
+#include "lib/ob_errno.h"
+
+namespace oceanbase
+{
+using namespace unittest;
+namespace sql
+{
+using namespace common;
+
+class TestDASRemoteStat : public unittest::ObSimpleClusterTestBase
+{
+public:
+  TestDASRemoteStat() : unittest::ObSimpleClusterTestBase("test_das_remote_stat") {}
+  int get_sysstat(const uint64_t tenant_id, const char *name, int64_t &value);
+};
+
+int TestDASRemoteStat::get_sysstat(const uint64_t tenant_id, const char *name, int64_t &value)
+{
+  int ret = OB_SUCCESS;
+  ObSqlString sql;
+  ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy();
+  value = 0;
+  if (OB_FAIL(sql.assign_fmt("select value from oceanbase.gv$sysstat where con_id = %lu and name = '%s'",
+                             tenant_id, name))) {
+  } else {
+    SMART_VAR(ObMySQLProxy::MySQLResult, result) {
+      if (OB_FAIL(sql_proxy.read(result, sql.ptr()))) {
+      } else if (OB_ISNULL(result.get_result())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("null result", KR(ret), K(sql));
+      } else {
+        sqlclient::ObMySQLResult &res = *result.get_result();
+        int64_t tmp_value = 0;
+        while (OB_SUCC(ret) && OB_SUCC(res.next())) {
+          EXTRACT_INT_FIELD_MYSQL(res, "value", tmp_value, int64_t);
+          value += tmp_value;
+        }
+        if (OB_ITER_END == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          LOG_WARN("fail to get sysstat", KR(ret), K(sql));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+TEST_F(TestDASRemoteStat, local_das_tasks_not_counted)
+{
+  uint64_t tenant_id = OB_INVALID_TENANT_ID;
+  int64_t affected_rows = 0;
+  ASSERT_EQ(OB_SUCCESS, create_tenant());
+  ASSERT_EQ(OB_SUCCESS, get_tenant_id(tenant_id));
+  ASSERT_EQ(OB_SUCCESS, get_curr_simple_server().init_sql_proxy2());
+  ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write("create table t1(c1 int primary key, c2 int) partition by hash(c1) partitions 8",
+                                        affected_rows));
+
+  int64_t rpc_cnt = 0;
+  int64_t task_cnt = 0;
+  int64_t wait_time = 0;
+  ASSERT_EQ(OB_SUCCESS, get_sysstat(tenant_id, "das remote rpc count", rpc_cnt));
+  ASSERT_EQ(OB_SUCCESS, get_sysstat(tenant_id, "das remote task count", task_cnt));
+  ASSERT_EQ(OB_SUCCESS, get_sysstat(tenant_id, "das remote wait time", wait_time));
+
+  // all the partitions are on the only server, so every das task is executed locally
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write("insert into t1 values (1, 1), (2, 2), (3, 3), (4, 4), (5, 5), (6, 6), (7, 7), (8, 8)",
+                                        affected_rows));
+  ASSERT_EQ(8, affected_rows);
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write("update t1 set c1 = c1 + 10 where c2 <= 4", affected_rows));
+  ASSERT_EQ(4, affected_rows);
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write("delete from t1 where c2 > 2", affected_rows));
+  ASSERT_EQ(6, affected_rows);
+
+  int64_t new_rpc_cnt = 0;
+  int64_t new_task_cnt = 0;
+  int64_t new_wait_time = 0;
+  ASSERT_EQ(OB_SUCCESS, get_sysstat(tenant_id, "das remote rpc count", new_rpc_cnt));
+  ASSERT_EQ(OB_SUCCESS, get_sysstat(tenant_id, "das remote task count", new_task_cnt));
+  ASSERT_EQ(OB_SUCCESS, get_sysstat(tenant_id, "das remote wait time", new_wait_time));
+  ASSERT_EQ(rpc_cnt, new_rpc_cnt);
+  ASSERT_EQ(task_cnt, new_task_cnt);
+  ASSERT_EQ(wait_time, new_wait_time);
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::unittest::init_log_and_gtest(argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
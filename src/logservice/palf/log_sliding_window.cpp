@@ -1341,7 +1341,9 @@ int LogSlidingWindow::check_and_switch_freeze_mode()
       PALF_LOG(INFO, "switch freeze_mode to period", K_(palf_id), K_(self), K(total_append_cnt));
     }
   } else if (PERIOD_FREEZE_MODE == freeze_mode_) {
-    if (total_append_cnt < APPEND_CNT_LB_FOR_PERIOD_FREEZE) {
+    // Keep grouping logs periodically until the load drops clearly below the switch barrier,
+    // a load around the barrier should not flip the mode every round.
+    if (total_append_cnt < APPEND_CNT_UB_FOR_FEEDBACK_FREEZE) {
       freeze_mode_ = FEEDBACK_FREEZE_MODE;
       PALF_LOG(INFO, "switch freeze_mode to feedback", K_(palf_id), K_(self), K(total_append_cnt));
       (void) feedback_freeze_last_log_();
@@ -480,6 +480,8 @@ public:
   static const int64_t APPEND_CNT_ARRAY_SIZE = 32;   // append次数统计数组的size
   static const uint64_t APPEND_CNT_ARRAY_MASK = APPEND_CNT_ARRAY_SIZE - 1;
   static const int64_t APPEND_CNT_LB_FOR_PERIOD_FREEZE = 140000;   // 切为PERIOD_FREEZE_MODE的append count下界
+  // 切回FEEDBACK_FREEZE_MODE的append count上界, 低于切换下界以避免负载在下界附近抖动时频繁切换
+  static const int64_t APPEND_CNT_UB_FOR_FEEDBACK_FREEZE = APPEND_CNT_LB_FOR_PERIOD_FREEZE / 2;
 private:
   struct LogTaskGuard
   {
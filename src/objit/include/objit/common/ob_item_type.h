@@ -2523,6 +2523,8 @@ typedef enum ObItemType
   // create mv build deferred
   T_MV_REFRESH_OPT,
   T_MV_BUILD_OPT,
+  T_COL_SKIP_INDEX_BLOOM_FILTER,
+  T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER,
   T_MAX //Attention: add a new type before T_MAX
 } ObItemType;
 
@@ -135,6 +135,14 @@ int ObDeadLockDetectorRpc::post_lcl_message(const ObAddr &dest_addr,
     ret = OB_INVALID_ARGUMENT;
     DETECT_LOG(WARN, "invalid argument",
               KR(ret), K(dest_addr), K(msg));
+  } else if (dest_addr == self_) {
+    // the dependency is on this server, deliver it directly without going through rpc
+    ObDeadLockDetectorMgr *p_deadlock_detector_mgr = MTL(ObDeadLockDetectorMgr *);
+    if (OB_ISNULL(p_deadlock_detector_mgr)) {
+      DETECT_LOG(ERROR, "can not get ObDeadLockDetectorMgr", KP(p_deadlock_detector_mgr));
+    } else if (OB_FAIL(p_deadlock_detector_mgr->process_lcl_message(msg))) {
+      DETECT_LOG(WARN, "process lcl message failed", KR(ret), KP(p_deadlock_detector_mgr));
+    }
   } else {
     if (OB_FAIL(proxy_->to(dest_addr)
                       .by(MTL_ID())
@@ -7468,6 +7468,7 @@ int ObTableSchema::check_skip_index_valid() const
 {
   int ret = OB_SUCCESS;
   int64_t aggregate_row_size = 0;
+  int64_t bloom_filter_size = 0;
   for (int64_t i = 0; OB_SUCC(ret) && i < column_cnt_; ++i) {
     const ObColumnSchemaV2 *column_schema = nullptr;
     int64_t column_agg_maximum_size = 0;
@@ -7489,6 +7490,13 @@ int ObTableSchema::check_skip_index_valid() const
       ret = OB_NOT_SUPPORTED;
       LOG_USER_ERROR(OB_NOT_SUPPORTED, "build skip index on invalid type");
       LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
+    } else if ((column_schema->get_skip_index_attr().has_bloom_filter() &&
+                !can_agg_bloom_filter(column_schema->get_meta_type().get_type())) ||
+               (column_schema->get_skip_index_attr().has_ngram_bloom_filter() &&
+                !can_agg_ngram_bloom_filter(column_schema->get_meta_type().get_type()))) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "build skip index on invalid type");
+      LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
     } else if (OB_FAIL(blocksstable::ObSkipIndexColMeta::calc_skip_index_maximum_size(
         column_schema->get_skip_index_attr(),
         column_schema->get_meta_type().get_type(),
@@ -7503,6 +7511,13 @@ int ObTableSchema::check_skip_index_valid() const
       LOG_USER_ERROR(OB_NOT_SUPPORTED,
       "current version of oceanbase has a limitation for skip index size in a single table, too many skip index columns");
       LOG_WARN("skip index row size too large", K(ret), KPC(column_schema), K(aggregate_row_size));
+    } else if (FALSE_IT(bloom_filter_size += ObSkipIndexColMeta::calc_bloom_filter_maximum_size(
+        column_schema->get_skip_index_attr()))) {
+    } else if (OB_UNLIKELY(bloom_filter_size > ObSkipIndexColMeta::SKIP_INDEX_BLOOM_FILTER_SIZE_LIMIT)) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED,
+      "current version of oceanbase has a limitation for skip index size in a single table, too many bloom filter skip index columns");
+      LOG_WARN("skip index bloom filter size too large", K(ret), KPC(column_schema), K(bloom_filter_size));
     }
   }
   return ret;
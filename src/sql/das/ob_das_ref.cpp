@@ -22,6 +22,7 @@
 #include "sql/das/ob_das_rpc_processor.h"
 #include "sql/das/ob_das_retry_ctrl.h"
 #include "observer/mysql/ob_query_retry_ctrl.h"
+#include "lib/stat/ob_diagnose_info.h"
 
 namespace oceanbase
 {
@@ -240,6 +241,13 @@ int ObDASRef::execute_all_task()
     uint32_t finished_cnt = 0;
     uint32_t high_priority_task_execution_cnt = 0;
     bool has_unstart_high_priority_tasks = true;
+    if (1 == aggregated_tasks_.get_size()) {
+      // all tasks run on one server, which executes a batch strictly in order and stops
+      // at the first failure. DELETE tasks can go ahead of the others in the same batch
+      // instead of costing an extra round trip.
+      aggregated_tasks_.get_obj_list().get_first()->get_obj()->merge_priority_tasks_ = true;
+      has_unstart_high_priority_tasks = false;
+    }
     while (finished_cnt < aggregated_tasks_.get_size() && OB_SUCC(ret)) {
       finished_cnt = 0;
       // execute tasks follows aggregated task state machine.
@@ -346,6 +354,9 @@ bool ObDASRef::check_rcode_can_retry(int ret)
 int ObDASRef::wait_executing_tasks()
 {
   int ret = OB_SUCCESS;
+  // only async remote tasks hold the concurrency, local tasks have finished when we get here
+  const bool has_remote_tasks = get_current_concurrency() < max_das_task_concurrency_;
+  const int64_t begin_ts = has_remote_tasks ? ObTimeUtility::current_time() : 0;
   {
     ObThreadCondGuard guard(cond_);
     while (OB_SUCC(ret) && get_current_concurrency() < max_das_task_concurrency_) {
@@ -355,6 +366,9 @@ int ObDASRef::wait_executing_tasks()
       }
     }
   }
+  if (has_remote_tasks) {
+    EVENT_ADD(DAS_REMOTE_WAIT_TIME, ObTimeUtility::current_time() - begin_ts);
+  }
   if (OB_SUCC(ret)) {
     if (OB_FAIL(process_remote_task_resp())) {
       LOG_WARN("failed to process remote task resp", K(ret));
@@ -670,6 +684,7 @@ void ObDasAggregatedTasks::reset()
   tasks_.reset();
   failed_tasks_.reset();
   success_tasks_.reset();
+  merge_priority_tasks_ = false;
 }
 
 void ObDasAggregatedTasks::reuse()
@@ -679,6 +694,7 @@ void ObDasAggregatedTasks::reuse()
   tasks_.reset();
   failed_tasks_.reset();
   success_tasks_.reset();
+  merge_priority_tasks_ = false;
 }
 
 int ObDasAggregatedTasks::push_back_task(ObIDASTaskOp *das_task)
@@ -736,7 +752,8 @@ int ObDasAggregatedTasks::get_aggregated_tasks(
   }
 
   // 3. if no unfinished high priority aggregated tasks exist, return all normal aggregated tasks.
-  if (tasks.count() == 0 && OB_SUCC(ret)) {
+  //    if priority tasks can be merged, normal tasks are appended after them.
+  if ((tasks.count() == 0 || merge_priority_tasks_) && OB_SUCC(ret)) {
     DLIST_FOREACH_X(curr, tasks_, OB_SUCC(ret)) {
       cur_task = curr->get_data();
       OB_ASSERT(cur_task != nullptr);
@@ -34,7 +34,8 @@ struct ObDasAggregatedTasks
         high_priority_tasks_(),
         tasks_(),
         failed_tasks_(),
-        success_tasks_() {}
+        success_tasks_(),
+        merge_priority_tasks_(false) {}
   ~ObDasAggregatedTasks() { reset(); };
   void reset();
   void reuse();
@@ -63,12 +64,16 @@ struct ObDasAggregatedTasks
                K(high_priority_tasks_.get_size()),
                K(tasks_.get_size()),
                K(failed_tasks_.get_size()),
-               K(success_tasks_.get_size()));
+               K(success_tasks_.get_size()),
+               K_(merge_priority_tasks));
   common::ObAddr server_;
   DasTaskLinkedList high_priority_tasks_;
   DasTaskLinkedList tasks_;
   DasTaskLinkedList failed_tasks_;
   DasTaskLinkedList success_tasks_;
+  // when true, high priority tasks are returned together with (and ahead of) the
+  // normal tasks, so that they can be shipped to the server in one batch.
+  bool merge_priority_tasks_;
 };
 
 struct DasRefKey
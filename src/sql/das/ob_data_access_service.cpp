@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX SQL_DAS
 #include "observer/ob_srv_network_frame.h"
 #include "observer/mysql/ob_query_retry_ctrl.h"
+#include "lib/stat/ob_diagnose_info.h"
 #include "sql/das/ob_data_access_service.h"
 #include "sql/das/ob_das_define.h"
 #include "sql/das/ob_das_extra_data.h"
@@ -482,6 +483,9 @@ int ObDataAccessService::do_async_remote_das_task(
     for (int i = 0; i < task_ops.count(); i++) {
       session->get_trans_result().add_touched_ls(task_ops.at(i)->get_ls_id());
     }
+  } else {
+    EVENT_INC(DAS_REMOTE_RPC_COUNT);
+    EVENT_ADD(DAS_REMOTE_TASK_COUNT, task_ops.count());
   }
   if (OB_FAIL(ret)) {
     if (nullptr != das_async_cb) {
@@ -576,6 +580,9 @@ int ObDataAccessService::do_sync_remote_das_task(
       for (int i = 0; i < task_ops.count(); i++) {
         session->get_trans_result().add_touched_ls(task_ops.at(i)->get_ls_id());
       }
+    } else {
+      EVENT_INC(DAS_REMOTE_RPC_COUNT);
+      EVENT_ADD(DAS_REMOTE_TASK_COUNT, task_ops.count());
     }
     if (OB_FAIL(ret)) {
       for (int i = 0; i < task_ops.count(); i++) {
@@ -611,6 +611,14 @@ int ObGroupJoinBufffer::batch_fill_group_buffer(const int64_t max_row_cnt,
         DASGroupScanMarkGuard mark_guard(ctx_->get_das_ctx(), true);
         if (OB_FAIL(left_->get_next_batch(max_row_cnt, batch_rows))) {
           LOG_WARN("get next batch from left failed", KR(ret));
+        } else if (spec_->use_rich_format_) {
+          // left rows are stored and saved by datums, cast rich format vectors to uniform first
+          const ExprFixedArray &left_exprs = left_->get_spec().output_;
+          for (int64_t i = 0; OB_SUCC(ret) && i < left_exprs.count(); i++) {
+            if (OB_FAIL(left_exprs.at(i)->cast_to_uniform(batch_rows->size_, *eval_ctx_))) {
+              LOG_WARN("cast left expr to uniform failed", KR(ret));
+            }
+          }
         }
         for (int64_t l_idx = 0;  OB_SUCC(ret) && l_idx < batch_rows->size_; l_idx++) {
           if (batch_rows->skip_->exist(l_idx)) {
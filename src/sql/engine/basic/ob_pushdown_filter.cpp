@@ -2017,6 +2017,47 @@ ObBlackFilterExecutor::~ObBlackFilterExecutor()
   }
 }
 
+bool ObBlackFilterExecutor::is_const_like_filter() const
+{
+  bool bret = false;
+  const ObExpr *expr = 1 == filter_.filter_exprs_.count() ? filter_.filter_exprs_.at(0) : nullptr;
+  if (nullptr == expr || T_OP_LIKE != expr->type_ || 3 != expr->arg_cnt_) {
+  } else if (nullptr == expr->args_[0] || nullptr == expr->args_[1] || nullptr == expr->args_[2]) {
+  } else {
+    bret = T_REF_COLUMN == expr->args_[0]->type_
+        && expr->args_[1]->is_const_expr()
+        && expr->args_[2]->is_const_expr()
+        && expr->args_[0]->obj_meta_.get_collation_type() == expr->args_[1]->obj_meta_.get_collation_type();
+  }
+  return bret;
+}
+
+int ObBlackFilterExecutor::get_like_pattern(
+    const ObExpr *&column_expr,
+    const common::ObDatum *&pattern,
+    const common::ObDatum *&escape)
+{
+  int ret = OB_SUCCESS;
+  column_expr = nullptr;
+  pattern = nullptr;
+  escape = nullptr;
+  if (is_const_like_filter()) {
+    const ObExpr *expr = filter_.filter_exprs_.at(0);
+    ObDatum *pattern_datum = nullptr;
+    ObDatum *escape_datum = nullptr;
+    if (OB_FAIL(expr->args_[1]->eval(op_.get_eval_ctx(), pattern_datum))) {
+      LOG_WARN("Failed to eval like pattern", K(ret));
+    } else if (OB_FAIL(expr->args_[2]->eval(op_.get_eval_ctx(), escape_datum))) {
+      LOG_WARN("Failed to eval like escape", K(ret));
+    } else {
+      column_expr = expr->args_[0];
+      pattern = pattern_datum;
+      escape = escape_datum;
+    }
+  }
+  return ret;
+}
+
 int ObBlackFilterExecutor::filter(ObEvalCtx &eval_ctx, const sql::ObBitVector &skip_bit, bool &filtered)
 {
   int ret = OB_SUCCESS;
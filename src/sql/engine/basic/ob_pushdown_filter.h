@@ -759,6 +759,13 @@ public:
                    const int64_t end,
                    common::ObBitmap &result_bitmap);
   int get_datums_from_column(common::ObIArray<blocksstable::ObSqlDatumInfo> &datum_infos);
+  // Whether the filter is `column LIKE const_pattern` with the same collation on both sides.
+  bool is_const_like_filter() const;
+  // Get the constant pattern and escape of `column LIKE pattern` filter, which is used by
+  // ngram bloom filter skipping index. Output exprs are nullptr for other filters.
+  int get_like_pattern(const ObExpr *&column_expr,
+                       const common::ObDatum *&pattern,
+                       const common::ObDatum *&escape);
   INHERIT_TO_STRING_KV("ObPushdownBlackFilterExecutor", ObPhysicalFilterExecutor,
                        K_(filter), KP_(skip_bit));
   virtual int filter(ObEvalCtx &eval_ctx, const sql::ObBitVector &skip_bit, bool &filtered) override;
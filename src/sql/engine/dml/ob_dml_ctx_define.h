@@ -531,13 +531,19 @@ struct ObDMLBaseRtDef
   //some modules to access the das rtdef
   ObDASDMLBaseRtDef &das_base_rtdef_;
   FkCheckerArray fk_checker_array_;
+  //tablet location of the last routed row, consecutive rows of bulk dml
+  //usually fall into the same tablet, the location lookup can be skipped for them
+  common::ObTabletID last_tablet_id_;
+  ObDASTabletLoc *last_tablet_loc_;
 protected:
   ObDMLBaseRtDef(ObDASDMLBaseRtDef &das_base_rtdef)
     : trig_rtdef_(),
       cur_row_num_(0),
       check_location_(nullptr),
       check_row_(nullptr),
-      das_base_rtdef_(das_base_rtdef)
+      das_base_rtdef_(das_base_rtdef),
+      last_tablet_id_(),
+      last_tablet_loc_(nullptr)
   { }
 };
 
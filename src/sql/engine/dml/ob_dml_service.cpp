@@ -2079,6 +2079,24 @@ int ObDMLService::init_related_das_rtdef(ObDMLRtCtx &dml_rtctx,
   return ret;
 }
 
+int ObDMLService::extended_tablet_loc(ObDASCtx &das_ctx,
+                                      ObDMLBaseRtDef &dml_rtdef,
+                                      ObDASTableLoc &table_loc,
+                                      const ObTabletID &tablet_id,
+                                      ObDASTabletLoc *&tablet_loc)
+{
+  int ret = OB_SUCCESS;
+  if (OB_NOT_NULL(dml_rtdef.last_tablet_loc_) && dml_rtdef.last_tablet_id_ == tablet_id) {
+    tablet_loc = dml_rtdef.last_tablet_loc_;
+  } else if (OB_FAIL(das_ctx.extended_tablet_loc(table_loc, tablet_id, tablet_loc))) {
+    LOG_WARN("extended tablet loc failed", K(ret), K(tablet_id));
+  } else {
+    dml_rtdef.last_tablet_id_ = tablet_id;
+    dml_rtdef.last_tablet_loc_ = tablet_loc;
+  }
+  return ret;
+}
+
 int ObDMLService::check_dml_tablet_validity(ObDMLRtCtx &dml_rtctx,
                                             const ObDASTabletLoc &tablet_loc,
                                             const ExprFixedArray &row,
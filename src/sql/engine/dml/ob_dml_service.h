@@ -227,6 +227,13 @@ public:
                                              ObDASDMLBaseRtDef &rtdef,
                                              const ObDASDMLBaseCtDef &related_ctdef,
                                              ObDASDMLBaseRtDef &related_rtdef);
+  //find the tablet location of tablet_id, reuse the location of the last row if it is
+  //routed to the same tablet
+  static int extended_tablet_loc(ObDASCtx &das_ctx,
+                                 ObDMLBaseRtDef &dml_rtdef,
+                                 ObDASTableLoc &table_loc,
+                                 const common::ObTabletID &tablet_id,
+                                 ObDASTabletLoc *&tablet_loc);
   static int check_dml_tablet_validity(ObDMLRtCtx &dml_rtctx,
                                        const ObDASTabletLoc &tablet_loc,
                                        const ExprFixedArray &row,
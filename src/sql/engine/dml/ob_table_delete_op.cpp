@@ -239,7 +239,8 @@ OB_INLINE int ObTableDeleteOp::calc_tablet_loc(const ObDelCtDef &del_ctdef,
       ObTabletID tablet_id;
       if (OB_FAIL(ObExprCalcPartitionBase::calc_part_and_tablet_id(calc_part_id_expr, eval_ctx_, partition_id, tablet_id))) {
         LOG_WARN("calc part and tablet id by expr failed", K(ret));
-      } else if (OB_FAIL(DAS_CTX(ctx_).extended_tablet_loc(table_loc, tablet_id, tablet_loc))) {
+      } else if (OB_FAIL(ObDMLService::extended_tablet_loc(DAS_CTX(ctx_), del_rtdef, table_loc,
+                                                           tablet_id, tablet_loc))) {
         LOG_WARN("extended tablet loc failed", K(ret));
       }
     }
@@ -687,12 +687,16 @@ int ObTableReplaceOp::calc_insert_tablet_loc(const ObInsCtDef &ins_ctdef,
       ObDASTableLoc &table_loc = *ins_rtdef.das_rtdef_.table_loc_;
       if (OB_FAIL(ObExprCalcPartitionBase::calc_part_and_tablet_id(calc_part_id_expr, eval_ctx_, partition_id, tablet_id))) {
         LOG_WARN("calc part and tablet id by expr failed", K(ret));
+      } else if (OB_NOT_NULL(ins_rtdef.last_tablet_loc_) && ins_rtdef.last_tablet_id_ == tablet_id) {
+        // same tablet as the last row, the partition hint has been checked
+        tablet_loc = ins_rtdef.last_tablet_loc_;
       } else if (!ins_ctdef.multi_ctdef_->hint_part_ids_.empty()
           && !has_exist_in_array(ins_ctdef.multi_ctdef_->hint_part_ids_, partition_id)) {
         ret = OB_PARTITION_NOT_MATCH;
         LOG_DEBUG("Partition not match", K(ret),
                   K(partition_id), K(ins_ctdef.multi_ctdef_->hint_part_ids_));
-      } else if (OB_FAIL(DAS_CTX(ctx_).extended_tablet_loc(table_loc, tablet_id, tablet_loc))) {
+      } else if (OB_FAIL(ObDMLService::extended_tablet_loc(DAS_CTX(ctx_), ins_rtdef, table_loc,
+                                                           tablet_id, tablet_loc))) {
         LOG_WARN("extended tablet loc failed", K(ret));
       }
     }
@@ -716,7 +720,8 @@ int ObTableReplaceOp::calc_delete_tablet_loc(const ObDelCtDef &del_ctdef,
       ObDASTableLoc &table_loc = *del_rtdef.das_rtdef_.table_loc_;
       if (OB_FAIL(ObExprCalcPartitionBase::calc_part_and_tablet_id(calc_part_id_expr, eval_ctx_, partition_id, tablet_id))) {
         LOG_WARN("calc part and tablet id by expr failed", K(ret));
-      } else if (OB_FAIL(DAS_CTX(ctx_).extended_tablet_loc(table_loc, tablet_id, tablet_loc))) {
+      } else if (OB_FAIL(ObDMLService::extended_tablet_loc(DAS_CTX(ctx_), del_rtdef, table_loc,
+                                                           tablet_id, tablet_loc))) {
         LOG_WARN("extended tablet loc failed", K(ret));
       }
     }
@@ -326,12 +326,14 @@ OB_INLINE int ObTableUpdateOp::calc_tablet_loc(const ObUpdCtDef &upd_ctdef,
     if (OB_SUCC(ret)) {
       ObDASTableLoc &table_loc = *upd_rtdef.dupd_rtdef_.table_loc_;
       if (old_tablet_id == new_tablet_id) {
-        if (OB_FAIL(DAS_CTX(ctx_).extended_tablet_loc(table_loc, old_tablet_id, old_tablet_loc))) {
+        if (OB_FAIL(ObDMLService::extended_tablet_loc(DAS_CTX(ctx_), upd_rtdef, table_loc,
+                                                      old_tablet_id, old_tablet_loc))) {
           LOG_WARN("extended old row tablet loc failed", K(ret), K(old_tablet_id));
         } else {
           new_tablet_loc = old_tablet_loc;
         }
-      } else if (OB_FAIL(DAS_CTX(ctx_).extended_tablet_loc(table_loc, old_tablet_id, old_tablet_loc))) {
+      } else if (OB_FAIL(ObDMLService::extended_tablet_loc(DAS_CTX(ctx_), upd_rtdef, table_loc,
+                                                           old_tablet_id, old_tablet_loc))) {
         LOG_WARN("extended old tablet location failed", K(ret), K(old_tablet_id));
       } else if (OB_FAIL(DAS_CTX(ctx_).extended_tablet_loc(table_loc, new_tablet_id, new_tablet_loc))) {
         LOG_WARN("extended new tablet location failed", K(ret), K(new_tablet_id));
@@ -3711,9 +3711,11 @@ int ObSubQueryRelationalExpr::check_exists(const ObExpr &expr, ObEvalCtx &ctx, b
   } else if (OB_ISNULL(iter)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("NULL subquery iterator", K(ret));
-  } else if (OB_FAIL(iter->rewind())) {
+  } else if (!iter->can_probe_before_rewind() && OB_FAIL(iter->rewind())) {
       LOG_WARN("start iterate failed", K(ret));
   } else {
+    // rewind after missing in hashmap if the result may be cached
+    const bool lazy_rewind = iter->can_probe_before_rewind();
     bool found_in_hash_map = false;
     bool is_hash_enabled = iter->has_hashmap();
     if (is_hash_enabled) {
@@ -3732,6 +3734,8 @@ int ObSubQueryRelationalExpr::check_exists(const ObExpr &expr, ObEvalCtx &ctx, b
       }
     }
     if (OB_FAIL(ret) || found_in_hash_map) {
+    } else if (lazy_rewind && OB_FAIL(iter->rewind())) {
+      LOG_WARN("start iterate failed", K(ret));
     } else if (OB_FAIL(iter->get_next_row())) {
       if (OB_ITER_END == ret) {
         ret = OB_SUCCESS;
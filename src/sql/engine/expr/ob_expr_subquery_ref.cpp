@@ -304,6 +304,7 @@ int ObExprSubQueryRef::expr_eval(
   const ExtraInfo *extra_info = static_cast<ExtraInfo *>(expr.extra_info_);
   ObDatum *datum = NULL;
   ObSubQueryIterator *iter = NULL;
+  bool lazy_rewind = false;
   //对所有iter 进行reset操作
   if (OB_ISNULL(extra_info)) {
     ret = OB_ERR_UNEXPECTED;
@@ -313,6 +314,9 @@ int ObExprSubQueryRef::expr_eval(
   } else if (OB_ISNULL(iter)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("null iter returned", K(ret));
+  } else if (!extra_info->is_cursor_ && extra.is_scalar_ && iter->can_probe_before_rewind()) {
+    // scalar result may be cached, rewind after missing in hashmap
+    lazy_rewind = true;
   } else if (OB_FAIL(iter->rewind())) {
     LOG_WARN("filter to rewind subquery iterator", K(ret));
   }
@@ -416,6 +420,8 @@ int ObExprSubQueryRef::expr_eval(
         }
       }
       if (OB_FAIL(ret) || found_in_hash_map) {
+      } else if (lazy_rewind && OB_FAIL(iter->rewind())) {
+        LOG_WARN("failed to rewind subquery iterator", K(ret));
       } else if (OB_FAIL(iter->get_next_row())) {
         if (OB_LIKELY(OB_ITER_END == ret)) {
           ret = OB_SUCCESS;
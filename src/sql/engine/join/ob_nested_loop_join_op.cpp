@@ -695,6 +695,9 @@ int ObNestedLoopJoinOp::get_left_batch()
                && FALSE_IT(left_batch_.to_exprs(eval_ctx_))) {
     } else if (OB_FAIL(left_->get_next_batch(op_max_batch_size_, left_brs_))) {
       LOG_WARN("fail to get next batch", K(ret));
+    } else if (MY_SPEC.use_rich_format_
+               && OB_FAIL(cast_exprs_to_uniform(left_->get_spec().output_, left_brs_->size_))) {
+      LOG_WARN("fail to cast left exprs to uniform", K(ret));
     } else if (left_brs_->end_) {
       is_left_end_ = true;
     }
@@ -703,6 +706,11 @@ int ObNestedLoopJoinOp::get_left_batch()
     // do nothing
   } else if (left_brs_->end_ && left_brs_->size_ == 0) {
     ret = OB_ITER_END;
+  } else if (MY_SPEC.use_rich_format_
+             && (MY_SPEC.group_rescan_ || MY_SPEC.enable_px_batch_rescan_)
+             && OB_FAIL(init_exprs_uniform(left_->get_spec().output_, left_brs_->size_))) {
+    // left rows are read from the datum store
+    LOG_WARN("fail to init left exprs uniform", K(ret));
   } else {
     left_batch_.from_exprs(eval_ctx_, left_brs_->skip_, left_brs_->size_);
   }
@@ -759,6 +767,10 @@ int ObNestedLoopJoinOp::group_get_left_batch(const ObBatchRows *&left_brs)
             set_param_null();
             if (OB_FAIL(left_->get_next_batch(op_max_batch_size_, left_brs_))) {
               LOG_WARN("failed to get next left row", K(ret));
+            } else if (MY_SPEC.use_rich_format_
+                       && OB_FAIL(cast_exprs_to_uniform(left_->get_spec().output_,
+                                                        left_brs_->size_))) {
+              LOG_WARN("fail to cast left exprs to uniform", K(ret));
             } else if (left_brs_->end_) {
               is_left_end_ = true;
             }
@@ -928,8 +940,15 @@ int ObNestedLoopJoinOp::process_right_batch()
       left_batch_.extend_save(eval_ctx_, right_brs->size_);
     }
     left_expr_extend(right_brs->size_);
-    if (0 == conds.count()) {
+    if (MY_SPEC.use_rich_format_
+        && OB_FAIL(init_exprs_uniform(left_->get_spec().output_, right_brs->size_))) {
+      LOG_WARN("fail to init left exprs uniform", K(ret));
+    } else if (0 == conds.count()) {
       brs_.skip_->deep_copy(*right_brs->skip_, right_brs->size_);
+    } else if (MY_SPEC.use_rich_format_) {
+      if (OB_FAIL(vec_calc_other_conds(*right_brs))) {
+        LOG_WARN("fail to calc other conds", K(ret), K(right_brs->size_));
+      }
     } else {
       batch_info_guard.set_batch_size(right_brs->size_);
       bool is_match = false;
@@ -1005,6 +1024,10 @@ int ObNestedLoopJoinOp::output()
     left_batch_.to_exprs(eval_ctx_);
     brs_.size_ = left_batch_.get_size();
     left_matched_->reset(left_batch_.get_size());
+    if (MY_SPEC.use_rich_format_
+        && OB_FAIL(init_exprs_uniform(left_->get_spec().output_, brs_.size_))) {
+      LOG_WARN("fail to init left exprs uniform", K(ret));
+    }
   } else {
     // do nothing.
   }
@@ -1022,6 +1045,13 @@ int ObNestedLoopJoinOp::output()
       left_batch_.extend_save(eval_ctx_, 1);
     }
     left_batch_.to_exprs(eval_ctx_, l_idx_, 0);
+    if (!MY_SPEC.use_rich_format_) {
+      // do nothing
+    } else if (OB_FAIL(init_exprs_uniform(left_->get_spec().output_, brs_.size_))) {
+      LOG_WARN("fail to init left exprs uniform", K(ret));
+    } else if (OB_FAIL(init_exprs_uniform(right_->get_spec().output_, brs_.size_))) {
+      LOG_WARN("fail to init right exprs uniform", K(ret));
+    }
   }
 
   return ret;
@@ -1170,6 +1200,42 @@ int ObNestedLoopJoinOp::calc_other_conds(bool &is_match)
   return ret;
 }
 
+int ObNestedLoopJoinOp::vec_calc_other_conds(const ObBatchRows &right_brs)
+{
+  int ret = OB_SUCCESS;
+  bool all_filtered = false;
+  brs_.skip_->deep_copy(*right_brs.skip_, right_brs.size_);
+  brs_.all_rows_active_ = right_brs.all_rows_active_;
+  if (OB_FAIL(filter_rows(MY_SPEC.other_join_conds_, *brs_.skip_, right_brs.size_,
+                          all_filtered, brs_.all_rows_active_))) {
+    LOG_WARN("fail to filter other join conds", K(ret));
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinOp::cast_exprs_to_uniform(const ExprFixedArray &exprs, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < exprs.count(); i++) {
+    if (OB_FAIL(exprs.at(i)->cast_to_uniform(size, eval_ctx_))) {
+      LOG_WARN("fail to cast expr to uniform", K(ret), KPC(exprs.at(i)));
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinOp::init_exprs_uniform(const ExprFixedArray &exprs, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < exprs.count(); i++) {
+    const VectorFormat format = exprs.at(i)->is_batch_result() ? VEC_UNIFORM : VEC_UNIFORM_CONST;
+    if (OB_FAIL(exprs.at(i)->init_vector(eval_ctx_, format, size))) {
+      LOG_WARN("fail to init vector", K(ret), KPC(exprs.at(i)));
+    }
+  }
+  return ret;
+}
+
 int ObNestedLoopJoinOp::get_next_batch_from_right(const ObBatchRows *right_brs)
 {
   int ret = OB_SUCCESS;
@@ -172,6 +172,14 @@ private:
   void skip_l_idx();
   // for refactor vectorized end
 
+  // for rich format
+  // left rows are buffered and replayed through datums, so the left output exprs
+  // are kept in uniform format, right output exprs keep the format of right child.
+  int cast_exprs_to_uniform(const ExprFixedArray &exprs, const int64_t size);
+  int init_exprs_uniform(const ExprFixedArray &exprs, const int64_t size);
+  int vec_calc_other_conds(const ObBatchRows &right_brs);
+  // for rich format end
+
   bool continue_fetching() { return !(left_brs_->end_ || is_full());}
   virtual int do_drain_exch() override;
   virtual int inner_drain_exch() { return OB_SUCCESS; }
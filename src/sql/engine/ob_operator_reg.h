@@ -428,7 +428,8 @@ REGISTER_OPERATOR(ObLogJoin, PHY_VEC_HASH_JOIN, ObHashJoinVecSpec, ObHashJoinVec
 class ObNestedLoopJoinSpec;
 class ObNestedLoopJoinOp;
 REGISTER_OPERATOR(ObLogJoin, PHY_NESTED_LOOP_JOIN, ObNestedLoopJoinSpec,
-                  ObNestedLoopJoinOp, NOINPUT, VECTORIZED_OP);
+                  ObNestedLoopJoinOp, NOINPUT, VECTORIZED_OP, 0 /*version*/,
+                  SUPPORT_RICH_FORMAT, "PHY_VEC_NESTED_LOOP_JOIN");
 
 class ObLogSubPlanFilter;
 class ObSubPlanFilterSpec;
@@ -256,6 +256,19 @@ int ObSubQueryIterator::get_curr_probe_row()
   return ret;
 }
 
+bool ObSubQueryIterator::can_probe_before_rewind() const
+{
+  bool bret = false;
+  if (has_hashmap() && probe_row_.cnt_ > 0 && NULL != parent_) {
+    // das group rescan and px batch rescan consume the rescan params of left rows in order,
+    // keep rewinding for each left row in those modes
+    const ObSubPlanFilterSpec &spec = parent_->get_spec();
+    bret = !parent_->enable_left_das_batch()
+           && (spec.enable_px_batch_rescans_.empty() || !spec.enable_px_batch_rescans_.at(id_));
+  }
+  return bret;
+}
+
 int ObSubQueryIterator::get_refactored(ObDatum &out)
 {
   int ret = OB_SUCCESS;
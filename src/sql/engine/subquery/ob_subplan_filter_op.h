@@ -78,6 +78,8 @@ public:
                            ObMemAttr(tenant_id, "SqlSQIterND", ObCtxIds::DEFAULT_CTX_ID));
   }
   bool has_hashmap() const { return hashmap_.created(); }
+  //probe hashmap with curr exec params before rewind, subplan is rescanned only if missed
+  bool can_probe_before_rewind() const;
   int init_probe_row(const int64_t cnt);
   int get_arena_allocator(common::ObIAllocator *&alloc);
   //fill curr exec param into probe_row_
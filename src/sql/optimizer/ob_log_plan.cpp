@@ -5922,12 +5922,16 @@ int ObLogPlan::check_table_columns_can_storage_pushdown(const uint64_t tenant_id
   static const int64_t COLUMN_STORE_WIDE_TABLE = 100;
   static const double MAX_NDV_RATIO = 0.2;
   static const double AVG_COLUMN_STORE_COLUMN_RATIO = 0.5;
+  // keep the same with the micro block level decision of storage, see ObGroupByCell::decide_use_group_by
+  static const double MAX_MICRO_NDV_RATIO = 0.5;
+  static const int64_t MAX_MICRO_NDV = 16384;
 
   const ObTableSchema *table_schema = NULL;
   ObSchemaGetterGuard *schema_guard = NULL;
   ObLogicalOperator *best_plan = NULL;
   const ObDMLStmt *stmt = NULL;
   double group_ndv = 1.0;
+  double micro_ndv = -1.0;
   ObColumnRefRawExpr* column = NULL;
   const OptTableMeta *table_meta = NULL;
   const OptColumnMeta *column_meta = NULL;
@@ -5965,8 +5969,18 @@ int ObLogPlan::check_table_columns_can_storage_pushdown(const uint64_t tenant_id
       can_push = (micro_block_avg_count * table_meta->get_rows()) > (MAX_MICRO_NDV_FACTOR * column_meta->get_ndv()) &&
                  column_meta->get_ndv() < MAX_NDV_RATIO * table_meta->get_rows();
     }
+    if (!can_push && !table_schema->is_column_store_supported()) {
+      // row store does group by on the dictionary of each encoded micro block, it is worth only
+      // if the distinct count of a micro block is small enough, estimate it by the ndv of column
+      micro_ndv = ObOptSelectivity::scale_distinct(micro_block_avg_count,
+                                                   table_meta->get_rows(),
+                                                   column_meta->get_ndv());
+      can_push = column_meta->get_ndv() < MAX_NDV_RATIO * table_meta->get_rows() &&
+                 micro_ndv < MAX_MICRO_NDV_RATIO * micro_block_avg_count &&
+                 micro_ndv < MAX_MICRO_NDV;
+    }
   }
-  LOG_TRACE("check pushdown", K(ret), K(can_push),
+  LOG_TRACE("check pushdown", K(ret), K(can_push), K(micro_ndv),
       "total rows", table_meta ? table_meta->get_rows() : -1,
       "micro cnt", table_meta ? table_meta->get_micro_block_count() : -1,
       "ndv", column_meta ? column_meta->get_ndv() : -1);
@@ -88,6 +88,7 @@ static const NonReservedKeyword Mysql_none_reserved_keywords[] =
   {"blob", BLOB},
   {"block", BLOCK},
   {"block_size", BLOCK_SIZE},
+  {"bloom_filter", BLOOM_FILTER},
   {"bool", BOOL},
   {"boolean", BOOLEAN},
   {"bootstrap", BOOTSTRAP},
@@ -561,6 +562,7 @@ static const NonReservedKeyword Mysql_none_reserved_keywords[] =
   {"new", NEW},
   {"never", NEVER},
   {"next", NEXT},
+  {"ngram_bloom_filter", NGRAM_BLOOM_FILTER},
   {"no", NO},
   {"no_write_to_binlog", NO_WRITE_TO_BINLOG},
   {"noarchivelog", NOARCHIVELOG},
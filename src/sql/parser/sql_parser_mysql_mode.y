@@ -322,6 +322,7 @@ END_P SET_VAR DELIMITER
 
         NAME NAMES NAMESPACE NATIONAL NCHAR NDB NDBCLUSTER NESTED NEW NEXT NO NOAUDIT NODEGROUP NONE NORMAL NOW NOWAIT NEVER
         NOMINVALUE NOMAXVALUE NOORDER NOCYCLE NOCACHE NO_WAIT NULLS NUMBER NVARCHAR NTILE NTH_VALUE NOARCHIVELOG NETWORK NOPARALLEL
+        NGRAM_BLOOM_FILTER
         NULL_IF_EXETERNAL
 
         OBSOLETE OBJECT OCCUR OF OFF OFFSET OLD OLD_PASSWORD ONE ONE_SHOT ONLY OPEN OPTIONS ORDINALITY ORIG_DEFAULT OWNER OLD_KEY OVER
@@ -21471,6 +21472,14 @@ MIN_MAX
 {
   malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_SUM)
 }
+| BLOOM_FILTER
+{
+  malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_BLOOM_FILTER);
+}
+| NGRAM_BLOOM_FILTER
+{
+  malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER);
+}
 ;
 
 lob_chunk_size:
@@ -21920,6 +21929,7 @@ ACCOUNT
 |       NEW
 |       NEVER
 |       NEXT
+|       NGRAM_BLOOM_FILTER
 |       NO
 |       NOARCHIVELOG
 |       NOAUDIT
@@ -12215,6 +12215,36 @@ int ObDDLResolver::resolve_column_skip_index(
             skip_index_column_attr.set_sum();
             break;
           }
+          case T_COL_SKIP_INDEX_BLOOM_FILTER: {
+            if (tenant_data_version < DATA_VERSION_4_3_2_0) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_WARN("tenant data version is less than 4.3.2, bloom filter skip index is not supported",
+                  K(ret), K(tenant_data_version));
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "tenant data version is less than 4.3.2, bloom filter skip index");
+            } else if (OB_UNLIKELY(!can_agg_bloom_filter(column_schema.get_data_type()))) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "build bloom filter skip index on invalid type");
+              LOG_WARN("not supported bloom filter skip index on column type", K(ret), K(column_schema));
+            } else {
+              skip_index_column_attr.set_bloom_filter();
+            }
+            break;
+          }
+          case T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER: {
+            if (tenant_data_version < DATA_VERSION_4_3_2_0) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_WARN("tenant data version is less than 4.3.2, ngram bloom filter skip index is not supported",
+                  K(ret), K(tenant_data_version));
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "tenant data version is less than 4.3.2, ngram bloom filter skip index");
+            } else if (OB_UNLIKELY(!can_agg_ngram_bloom_filter(column_schema.get_data_type()))) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "build ngram bloom filter skip index on invalid type");
+              LOG_WARN("not supported ngram bloom filter skip index on column type", K(ret), K(column_schema));
+            } else {
+              skip_index_column_attr.set_ngram_bloom_filter();
+            }
+            break;
+          }
           default: {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("invalid skip index type", K(ret), K(i), K(type_node->type_));
@@ -778,6 +778,7 @@ void ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::
   reset_tree_handles();
   read_handles_.reset();
   inner_reset();
+  is_hot_prefetch_ = false;
   max_range_prefetching_cnt_ = 0;
   max_micro_handle_cnt_ = 0;
   ObIndexTreePrefetcher::reset();
@@ -868,7 +869,15 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::g
 {
   int ret = OB_SUCCESS;
   depth = 0;
-  prefetch_depth_ = MIN(2 * prefetch_depth_, DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT);
+  if (is_hot_prefetch_) {
+    // deep prefetch can not hide any io latency when micro blocks are in block cache,
+    // but holds more cache handles and parses index ahead in vain, so the depth shrinks
+    // to HOT_SCAN_PREFETCH_DEPTH and never grows faster than a cold scan
+    prefetch_depth_ = MIN(MIN(2 * prefetch_depth_, MAX(HOT_SCAN_PREFETCH_DEPTH, prefetch_depth_ / 2)),
+                          DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT);
+  } else {
+    prefetch_depth_ = MIN(2 * prefetch_depth_, DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT);
+  }
   if (need_check_prefetch_depth_ && access_ctx_->limit_param_->offset_ < INT32_MAX && access_ctx_->limit_param_->limit_ < INT32_MAX) {
     int64_t prefetch_micro_cnt = MAX(1,
           (access_ctx_->limit_param_->offset_ + access_ctx_->limit_param_->limit_ - access_ctx_->out_cnt_ + \
@@ -1220,6 +1229,8 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
   int64_t prefetched_cnt = 0;
   int64_t prefetch_micro_idx = 0;
   int64_t prefetch_depth = 0;
+  int64_t cache_hit_cnt = 0;
+  int64_t io_cnt = 0;
   if (OB_UNLIKELY(index_tree_height_ <= cur_level_ ||
                   micro_data_prefetch_idx_ - cur_micro_data_fetch_idx_ > max_micro_handle_cnt_)) {
     ret = OB_ERR_UNEXPECTED;
@@ -1285,6 +1296,10 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
             }
           } else if (OB_FAIL(prefetch_block_data(block_info, micro_data_handles_[prefetch_micro_idx]))) {
             LOG_WARN("fail to prefetch_block_data", K(ret), K(block_info));
+          } else if (ObSSTableMicroBlockState::IN_BLOCK_CACHE == micro_data_handles_[prefetch_micro_idx].block_state_) {
+            ++cache_hit_cnt;
+          } else {
+            ++io_cnt;
           }
 
           if OB_SUCC(ret) {
@@ -1309,8 +1324,11 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
         prefetched_cnt = 0;
       }
     }
+    if (OB_SUCC(ret) && 0 < cache_hit_cnt + io_cnt) {
+      is_hot_prefetch_ = 0 == io_cnt;
+    }
   }
-  LOG_DEBUG("[INDEX BLOCK] prefetched info", K(ret),  KPC(this));
+  LOG_DEBUG("[INDEX BLOCK] prefetched info", K(ret), K(cache_hit_cnt), K(io_cnt), KPC(this));
   return ret;
 }
 
@@ -387,6 +387,7 @@ public:
       agg_row_store_(nullptr),
       can_blockscan_(false),
       need_check_prefetch_depth_(false),
+      is_hot_prefetch_(false),
       tree_handle_cap_(0),
       prefetch_depth_(1),
       max_range_prefetching_cnt_(0),
@@ -485,7 +486,7 @@ public:
                        K_(cur_micro_data_fetch_idx), K_(micro_data_prefetch_idx), K_(max_micro_handle_cnt),
                        K_(iter_type), K_(cur_level), K_(index_tree_height), K_(max_rescan_height), KP_(long_life_allocator), K_(prefetch_depth),
                        K_(total_micro_data_cnt), KP_(query_range), K_(tree_handle_cap),
-                       K_(can_blockscan), K_(need_check_prefetch_depth),
+                       K_(can_blockscan), K_(need_check_prefetch_depth), K_(is_hot_prefetch),
                        K(ObArrayWrap<ObIndexTreeLevelHandle>(tree_handles_, index_tree_height_)));
 protected:
   int init_basic_info(
@@ -525,6 +526,7 @@ protected:
   static const int32_t DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT = DATA_PREFETCH_DEPTH;
   static const int32_t INDEX_TREE_PREFETCH_DEPTH = INDEX_PREFETCH_DEPTH;
   static const int32_t SSTABLE_MICRO_AVG_COUNT = 100;
+  static const int32_t HOT_SCAN_PREFETCH_DEPTH = 4;
   struct ObIndexBlockReadHandle {
     ObIndexBlockReadHandle() :
         end_prefetched_row_idx_(-1),
@@ -694,6 +696,8 @@ public:
 protected:
   bool can_blockscan_;
   bool need_check_prefetch_depth_;
+  // all micro blocks prefetched last time hit the block cache, kept across rescans
+  bool is_hot_prefetch_;
   int16_t tree_handle_cap_;
   int16_t prefetch_depth_;
   int32_t max_range_prefetching_cnt_;
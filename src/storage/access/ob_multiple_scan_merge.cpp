@@ -409,13 +409,15 @@ int ObMultipleScanMerge::inner_get_next_row(ObDatumRow &row)
       row.count_ = 0;
       row.row_flag_.set_flag(ObDmlFlag::DF_NOT_EXIST);
 
-      if (access_param_->iter_param_.enable_pd_blockscan() &&
-          1 == consumer_cnt_) {
-        // single consumer
+      if (1 == consumer_cnt_ &&
+          (access_param_->iter_param_.enable_pd_blockscan() || rows_merger_->empty())) {
+        // single consumer, rows can be returned without merge if the iter can blockscan
+        // until the border rowkey, or all the other iters have reached the end
+        const bool is_last_iter = rows_merger_->empty();
         if (OB_ISNULL(iter = iters_.at(consumers_[0]))) {
           ret = OB_ERR_UNEXPECTED;
           STORAGE_LOG(WARN, "Unexpected null iter", K(ret), K_(consumer_cnt));
-        } else if (iter->can_blockscan()) {
+        } else if (is_last_iter || iter->can_blockscan()) {
           if (OB_FAIL(iter->get_next_row(item.row_))) {
             if (OB_ITER_END == ret) {
               consumer_cnt_ = 0;
@@ -443,11 +445,21 @@ int ObMultipleScanMerge::inner_get_next_row(ObDatumRow &row)
             row.fast_filter_skipped_ = item.row_->fast_filter_skipped_;
             ++row_stat_.result_row_count_;
             ++row_stat_.base_row_count_;
+            if (is_last_iter && !iter->can_blockscan() && iter->is_sstable_iter() &&
+                access_param_->iter_param_.enable_pd_blockscan() &&
+                OB_FAIL(prepare_blockscan(*iter))) {
+              STORAGE_LOG(WARN, "Failed to check blockscan", K(ret));
+            }
             break;
           } else {
             //need retry
             consumer_cnt_ = 1;
             ++row_stat_.filt_del_count_;
+            if (0 == (row_stat_.filt_del_count_ % 10000) && !access_ctx_->query_flag_.is_daily_merge()) {
+              if (OB_FAIL(THIS_WORKER.check_status())) {
+                STORAGE_LOG(WARN, "query interrupt, ", K(ret));
+              }
+            }
             continue;
           }
         }
@@ -1565,7 +1565,7 @@ ObHyperLogLogAggCell::ObHyperLogLogAggCell(const ObAggCellBasicInfo &basic_info,
 void ObHyperLogLogAggCell::reset()
 {
   hash_func_ = nullptr;
-  if (OB_ISNULL(ndv_calculator_)) {
+  if (OB_NOT_NULL(ndv_calculator_)) {
     ndv_calculator_->destroy();
     allocator_.free(ndv_calculator_);
     ndv_calculator_ = nullptr;
@@ -1577,7 +1577,7 @@ void ObHyperLogLogAggCell::reset()
 void ObHyperLogLogAggCell::reuse()
 {
   ObAggCell::reuse();
-  if (OB_ISNULL(ndv_calculator_)) {
+  if (OB_NOT_NULL(ndv_calculator_)) {
     ndv_calculator_->reuse();
   }
 }
@@ -1650,7 +1650,8 @@ int ObHyperLogLogAggCell::eval(blocksstable::ObStorageDatum &storage_datum, cons
 }
 
 // eval_batch() is invoked by ObAggCell::eval_micro_block()
-// Like Min/Max aggregate, does not have the capability for batch processing now.
+// Setting the same hash value again does not change the buckets, so the hash of a datum which is
+// binary equal to the previous one is skipped, dict/rle/const encoded columns usually have runs.
 int ObHyperLogLogAggCell::eval_batch(const common::ObDatum *datums, const int64_t count)
 {
   int ret = OB_SUCCESS;
@@ -1658,15 +1659,20 @@ int ObHyperLogLogAggCell::eval_batch(const common::ObDatum *datums, const int64_
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid row count", K(ret), KP(datums), K(count));
   } else {
+    const common::ObDatum *last_datum = nullptr;
     for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
       uint64_t hash_value = 0; // same as ObAggregateProcessor llc hash_value
       const common::ObDatum &datum = datums[i];
       if (datum.is_null()) {
         // ndv does not consider null
+      } else if (nullptr != last_datum && last_datum->len_ == datum.len_ &&
+                 (last_datum->ptr_ == datum.ptr_ || 0 == MEMCMP(last_datum->ptr_, datum.ptr_, datum.len_))) {
+        // same as the last not null datum
       } else if (OB_FAIL(hash_func_(datum, hash_value, hash_value))) {
         LOG_WARN("Failed to do hash", K(ret));
       } else {
         ndv_calculator_->set(hash_value);
+        last_datum = &datum;
       }
     }
     if (OB_SUCC(ret)) {
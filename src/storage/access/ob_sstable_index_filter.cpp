@@ -14,6 +14,7 @@
 
 #include "ob_sstable_index_filter.h"
 #include "ob_table_access_param.h"
+#include "lib/stat/ob_diagnose_info.h"
 #include "storage/blocksstable/index_block/ob_index_block_row_struct.h"
 
 namespace oceanbase
@@ -67,6 +68,7 @@ int ObSSTableIndexFilter::check_range(
   } else {
     sql::ObBoolMask bm;
     bool can_use_skipping_index_filter = false;
+    EVENT_INC(ObStatEventIds::SKIP_INDEX_CHECK_BLOCK_CNT);
     for (int64_t i = 0; OB_SUCC(ret) && i < skipping_filter_nodes_.count(); ++i) {
       ObSkippingFilterNode &node = skipping_filter_nodes_[i];
       if (OB_FAIL(is_filtered_by_skipping_index(read_info, index_info, node, allocator))) {
@@ -81,6 +83,9 @@ int ObSSTableIndexFilter::check_range(
         LOG_WARN("Fail to execute skipping filter", K(ret), KP_(pushdown_filter));
       } else {
         index_info.set_filter_constant_type(bm.bmt_);
+        if (index_info.is_filter_always_false()) {
+          EVENT_INC(ObStatEventIds::SKIP_INDEX_SKIPPED_BLOCK_CNT);
+        }
         // Recover ObBoolMask of the filter.
         for (int64_t i = 0; OB_SUCC(ret) && i < skipping_filter_nodes_.count(); ++i) {
           ObSkippingFilterNode &node = skipping_filter_nodes_[i];
@@ -112,6 +117,20 @@ int ObSSTableIndexFilter::is_filtered_by_skipping_index(
   } else if (index_info.apply_skipping_filter_result(node.filter_)) {
     // There is no need to check skipping index because filter result is contant already.
     node.is_already_determinate_ = true;
+  } else if (node.filter_->is_filter_constant()) {
+    // Filter result is determined by another skipping index of the same filter.
+  } else if (node.filter_->is_filter_black_node()) {
+    auto *black_filter = static_cast<sql::ObBlackFilterExecutor *>(node.filter_);
+    const uint32_t col_offset = black_filter->get_col_offsets(is_cg_).at(0);
+    const uint32_t col_idx = static_cast<uint32_t>(read_info->get_columns_index().at(col_offset));
+    const ObObjMeta obj_meta = read_info->get_columns_desc().at(col_offset).col_type_;
+    if (OB_FAIL(skip_filter_executor_.falsifiable_pushdown_filter(col_idx,
+                                                                  obj_meta,
+                                                                  node.skip_index_type_,
+                                                                  index_info,
+                                                                  *black_filter))) {
+      LOG_WARN("Fail to falsifiable pushdown black filter", K(ret), K(black_filter));
+    }
   } else {
     auto *white_filter = static_cast<sql::ObWhiteFilterExecutor *>(node.filter_);
     const uint32_t col_offset = white_filter->get_col_offsets(is_cg_).at(0);
@@ -155,8 +174,7 @@ int ObSSTableIndexFilter::extract_skipping_filter_from_tree(
     sql::ObPushdownFilterExecutor &filter)
 {
   int ret = OB_SUCCESS;
-  if (filter.is_filter_white_node()) {
-    auto &white_filter = static_cast<sql::ObWhiteFilterExecutor &>(filter);
+  if (filter.is_filter_white_node() || filter.is_filter_black_node()) {
     IndexList index_list;
     if (OB_FAIL(find_skipping_index(read_info, filter, index_list))) {
       LOG_WARN("Fail to find useful skipping index", K(ret));
@@ -173,13 +191,13 @@ int ObSSTableIndexFilter::find_skipping_index(
     IndexList &index_list) const
 {
   int ret = OB_SUCCESS;
-  const uint64_t column_id = filter.get_col_ids().at(0);
+  const uint64_t column_id = 1 == filter.get_col_ids().count() ? filter.get_col_ids().at(0) : OB_INVALID_ID;
   const common::ObIArray<ObColumnParam *> *column_params = read_info->get_columns();
   const common::ObIArray<ObColExtend> *column_extend = read_info->get_columns_extend();
   if ((!is_cg_ && OB_ISNULL(column_params)) || OB_ISNULL(column_extend)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Unexpected nullptr column_params", K(ret), K_(is_cg), KP(column_params), KP(column_extend));
-  } else if (column_extend->empty()) {
+  } else if (column_extend->empty() || OB_INVALID_ID == column_id) {
   } else {
     int64_t index = -1;
     if (!is_cg_) {
@@ -199,8 +217,15 @@ int ObSSTableIndexFilter::find_skipping_index(
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("Unexpected column meta", K(column_id), K(index), KPC(read_info));
     } else {
-      const bool has_min_max = column_extend->at(index).skip_index_attr_.has_min_max();
-      if (has_min_max && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::MIN_MAX))) {
+      const share::schema::ObSkipIndexColumnAttr &skip_index_attr = column_extend->at(index).skip_index_attr_;
+      if (skip_index_attr.has_min_max()
+          && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::MIN_MAX))) {
+        LOG_WARN("Fail to push back skip index type", K(ret));
+      } else if (skip_index_attr.has_bloom_filter()
+          && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::BLOOM_FILTER))) {
+        LOG_WARN("Fail to push back skip index type", K(ret));
+      } else if (skip_index_attr.has_ngram_bloom_filter()
+          && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::NGRAM_BLOOM_FILTER))) {
         LOG_WARN("Fail to push back skip index type", K(ret));
       }
     }
@@ -284,8 +309,17 @@ int ObSSTableIndexFilterExtracter::extract_skipping_filter(
         LOG_WARN("Fail to extract min max index skipping filter", K(ret), K(skip_index_type));
       }
       break;
+    case blocksstable::ObSkipIndexType::BLOOM_FILTER:
+      if (OB_FAIL(ObSSTableIndexFilterExtracter::extract_bloom_filter_skipping_filter(filter, node))) {
+        LOG_WARN("Fail to extract bloom filter index skipping filter", K(ret), K(skip_index_type));
+      }
+      break;
+    case blocksstable::ObSkipIndexType::NGRAM_BLOOM_FILTER:
+      if (OB_FAIL(ObSSTableIndexFilterExtracter::extract_ngram_bloom_filter_skipping_filter(filter, node))) {
+        LOG_WARN("Fail to extract ngram bloom filter index skipping filter", K(ret), K(skip_index_type));
+      }
+      break;
     default:
-      // There are more skipping index types in the future.
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("Unepected skip index type", K(ret), K(skip_index_type));
   }
@@ -309,5 +343,64 @@ int ObSSTableIndexFilterExtracter::extract_min_max_skipping_filter(
   return ret;
 }
 
+int ObSSTableIndexFilterExtracter::extract_bloom_filter_skipping_filter(
+    const sql::ObPushdownFilterExecutor &filter,
+    ObSkippingFilterNode &node)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!filter.is_filter_node())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected not physical filter node", K(ret), K(filter.get_type()));
+  } else if (!filter.is_filter_white_node() || filter.is_filter_dynamic_node()) {
+    node.set_useless();
+  } else {
+    // bloom filter only works for equal and in filters whose params hash the same as column values
+    const auto &white_filter = static_cast<const sql::ObWhiteFilterExecutor &>(filter);
+    const sql::ObExpr *expr = white_filter.get_filter_node().expr_;
+    const sql::ObWhiteFilterOperatorType op_type = white_filter.get_op_type();
+    bool is_useful = false;
+    if (OB_ISNULL(expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected null filter expr", K(ret));
+    } else if (sql::WHITE_OP_EQ == op_type && 2 == expr->arg_cnt_) {
+      const int64_t column_idx = T_REF_COLUMN == expr->args_[0]->type_ ? 0 : 1;
+      is_useful = blocksstable::ObSkipIndexBloomFilter::is_hash_compatible(
+          expr->args_[column_idx]->obj_meta_, expr->args_[1 - column_idx]->obj_meta_);
+    } else if (sql::WHITE_OP_IN == op_type && 2 == expr->arg_cnt_ && nullptr != expr->args_[1]) {
+      const sql::ObExpr *param_expr = expr->args_[1];
+      is_useful = param_expr->arg_cnt_ > 0;
+      for (int64_t i = 0; is_useful && i < param_expr->arg_cnt_; ++i) {
+        is_useful = blocksstable::ObSkipIndexBloomFilter::is_hash_compatible(
+            expr->args_[0]->obj_meta_, param_expr->args_[i]->obj_meta_);
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (is_useful) {
+      node.skip_index_type_ = blocksstable::ObSkipIndexType::BLOOM_FILTER;
+    } else {
+      node.set_useless();
+    }
+  }
+  return ret;
+}
+
+int ObSSTableIndexFilterExtracter::extract_ngram_bloom_filter_skipping_filter(
+    const sql::ObPushdownFilterExecutor &filter,
+    ObSkippingFilterNode &node)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!filter.is_filter_node())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected not physical filter node", K(ret), K(filter.get_type()));
+  } else if (!filter.is_filter_black_node()) {
+    node.set_useless();
+  } else if (static_cast<const sql::ObBlackFilterExecutor &>(filter).is_const_like_filter()) {
+    node.skip_index_type_ = blocksstable::ObSkipIndexType::NGRAM_BLOOM_FILTER;
+  } else {
+    node.set_useless();
+  }
+  return ret;
+}
+
 } // namespace storage
 } // namespace oceanbase
@@ -47,5 +47,24 @@ int ObDictDatumIter::get_next(const ObDatum *&datum)
   return ret;
 }
 
+int ObFloatDigitDatumIter::get_next(const ObDatum *&datum)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(col_datums_.count() == idx_)) {
+    ret = OB_ITER_END;
+  } else if (col_datums_.at(idx_).is_null()) {
+    datum = &col_datums_.at(idx_);
+    idx_++;
+  } else {
+    datum_.ptr_ = reinterpret_cast<const char *>(digits_ + idx_);
+    datum_.pack_ = sizeof(int64_t);
+    datum = &datum_;
+    idx_++;
+  }
+
+  return ret;
+}
+
 }  // namespace blocksstable
 }  // namespace oceanbase
@@ -67,6 +67,25 @@ private:
   ObEncodingHashTable::ConstIterator iter_;
 };
 
+// iterate the integer digits of FLOAT encoding, null datums are returned as they are
+class ObFloatDigitDatumIter : public ObIDatumIter
+{
+public:
+  ObFloatDigitDatumIter(const ObColDatums &col_datums, const int64_t *digits)
+    : col_datums_(col_datums), digits_(digits), datum_(), idx_(0) { }
+  ~ObFloatDigitDatumIter() {}
+  ObFloatDigitDatumIter(const ObFloatDigitDatumIter&) = delete;
+  ObFloatDigitDatumIter &operator=(const ObFloatDigitDatumIter&) = delete;
+  int get_next(const ObDatum *&datum) override;
+  int64_t size() const override { return col_datums_.count(); }
+  virtual void reset() override { idx_ = 0; }
+
+private:
+  const ObColDatums &col_datums_;
+  const int64_t *digits_;
+  ObDatum datum_;
+  int64_t idx_;
+};
 
 }  // namespace blocksstable
 }  // namespace oceanbase
@@ -36,6 +36,7 @@ struct ObCSColumnHeader
     STRING = 1,
     INT_DICT = 2,
     STR_DICT = 3,
+    FLOAT = 4,
     MAX_TYPE
   };
 
@@ -46,6 +47,7 @@ struct ObCSColumnHeader
       case STRING :  { return "STRING"; }
       case INT_DICT: { return "INT_DICT"; }
       case STR_DICT: { return "STR_DICT"; }
+      case FLOAT:    { return "FLOAT"; }
       default:       { return "MAX_TYPE"; }
     }
   }
@@ -193,6 +195,53 @@ struct ObDictEncodingMeta final
 
 } __attribute__((packed));
 
+// Column meta of FLOAT encoding (ALP, adaptive lossless floating-point):
+// each non-exception value v is stored as an integer digit d = round(v * 10^exponent * 10^-factor),
+// and decoded as d * 10^factor / 10^exponent. Values that can't roundtrip bit-exactly are
+// exceptions, whose row ids and original values are stored following this meta:
+// | ObFloatEncodingMeta | exception row ids(uint32_t) | exception values(float/double) | digit stream |
+struct ObFloatEncodingMeta final
+{
+  static constexpr uint8_t OB_FLOAT_ENCODING_META_V1 = 0;
+  enum Attribute
+  {
+    IS_FLOAT = 0x1, // value is 4 bytes float, otherwise is 8 bytes double
+  };
+  ObFloatEncodingMeta()
+    : version_(OB_FLOAT_ENCODING_META_V1), attrs_(0),
+      exponent_(0), factor_(0), exception_cnt_(0) {}
+  void reuse()
+  {
+    version_ = OB_FLOAT_ENCODING_META_V1;
+    attrs_ = 0;
+    exponent_ = 0;
+    factor_ = 0;
+    exception_cnt_ = 0;
+  }
+
+  bool is_float() const { return attrs_ & IS_FLOAT; }
+  void set_is_float() { attrs_ |= IS_FLOAT; }
+  OB_INLINE int64_t get_value_size() const { return is_float() ? sizeof(float) : sizeof(double); }
+  OB_INLINE int64_t get_exception_data_size() const
+  {
+    return exception_cnt_ * (sizeof(uint32_t) + get_value_size());
+  }
+  // total length of meta and exceptions, which precede the digit stream
+  OB_INLINE int64_t get_column_meta_size() const
+  {
+    return sizeof(ObFloatEncodingMeta) + get_exception_data_size();
+  }
+
+  uint8_t version_;
+  uint8_t attrs_; // bitwise-or of Attribute
+  uint8_t exponent_;
+  uint8_t factor_;
+  uint32_t exception_cnt_;
+
+  TO_STRING_KV(K_(version), K_(attrs), K_(exponent), K_(factor), K_(exception_cnt));
+
+} __attribute__((packed));
+
 
 struct ObColumnEncodingIdentifier
 {
@@ -338,6 +387,7 @@ struct ObColumnCSEncodingCtx
 };
 
 //========================== ObColumnCSDecoderCtx ===================================//
+class ObFSSTStringDecoder;
 struct ObBaseColumnDecoderCtx
 {
   ObBaseColumnDecoderCtx() { reset(); }
@@ -391,21 +441,40 @@ struct ObIntegerColumnDecoderCtx : public ObBaseColumnDecoderCtx
   INHERIT_TO_STRING_KV("ObBaseColumnDecoderCtx", ObBaseColumnDecoderCtx, KP_(data), K_(datum_len), KPC_(ctx));
 };
 
+struct ObFloatColumnDecoderCtx : public ObBaseColumnDecoderCtx
+{
+  ObFloatColumnDecoderCtx()
+    : ObBaseColumnDecoderCtx(), data_(nullptr), ctx_(nullptr), float_meta_(nullptr),
+      exception_row_ids_(nullptr), exception_values_(nullptr), datum_len_(0) {}
+
+  const char *data_; // digit stream
+  const ObIntegerStreamDecoderCtx *ctx_;
+  const ObFloatEncodingMeta *float_meta_;
+  const uint32_t *exception_row_ids_; // sorted
+  const char *exception_values_;
+  uint32_t datum_len_;
+
+  INHERIT_TO_STRING_KV("ObBaseColumnDecoderCtx", ObBaseColumnDecoderCtx, KP_(data), K_(datum_len),
+      KPC_(ctx), KPC_(float_meta), KP_(exception_row_ids), KP_(exception_values));
+};
+
 struct ObStringColumnDecoderCtx : public ObBaseColumnDecoderCtx
 {
   ObStringColumnDecoderCtx()
     : ObBaseColumnDecoderCtx(),
       str_data_(nullptr), str_ctx_(nullptr),
       offset_data_(nullptr), offset_ctx_(nullptr),
-      need_copy_(false) {}
+      need_copy_(false), fsst_decoder_(nullptr) {}
   const char *str_data_;
   const ObStringStreamDecoderCtx *str_ctx_;
   const char *offset_data_;
   const ObIntegerStreamDecoderCtx *offset_ctx_; // this is nullptr for fixed len string
   bool need_copy_; // whether need copy string to datum or just modify the datum's ptr
+  // not null if string stream is fsst compressed, str_data_ and offset_data_ are the codes
+  ObFSSTStringDecoder *fsst_decoder_;
 
   INHERIT_TO_STRING_KV("ObBaseColumnDecoderCtx", ObBaseColumnDecoderCtx,
-      KP_(str_data), KPC_(str_ctx), KP_(offset_data), KPC_(offset_ctx), K_(need_copy));
+      KP_(str_data), KPC_(str_ctx), KP_(offset_data), KPC_(offset_ctx), K_(need_copy), KP_(fsst_decoder));
 };
 
 struct ObDictColumnDecoderCtx : public ObBaseColumnDecoderCtx
@@ -451,12 +520,14 @@ struct ObColumnCSDecoderCtx
     ObIntegerColumnDecoderCtx integer_ctx_;
     ObStringColumnDecoderCtx string_ctx_;
     ObDictColumnDecoderCtx dict_ctx_;
+    ObFloatColumnDecoderCtx float_ctx_;
   };
   void reset() { MEMSET(this, 0, sizeof(ObColumnCSDecoderCtx));}
   OB_INLINE bool is_integer_type() const { return ObCSColumnHeader::INTEGER == type_; }
   OB_INLINE bool is_string_type() const { return ObCSColumnHeader::STRING == type_; }
   OB_INLINE bool is_int_dict_type() const { return ObCSColumnHeader::INT_DICT == type_; }
   OB_INLINE bool is_string_dict_type() const { return ObCSColumnHeader::STR_DICT == type_; }
+  OB_INLINE bool is_float_type() const { return ObCSColumnHeader::FLOAT == type_; }
 
   ObBaseColumnDecoderCtx& get_base_ctx()
   {
@@ -467,6 +538,8 @@ struct ObColumnCSDecoderCtx
       base_ctx = &string_ctx_;
     } else if (is_int_dict_type() || is_string_dict_type()) {
       base_ctx = &dict_ctx_;
+    } else if (is_float_type()) {
+      base_ctx = &float_ctx_;
     }
     return *base_ctx;
   }
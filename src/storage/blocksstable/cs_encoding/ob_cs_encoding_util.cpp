@@ -14,6 +14,9 @@
 
 #include "ob_cs_encoding_util.h"
 #include "lib/wide_integer/ob_wide_integer_cmp_funcs.h"
+#include "ob_column_datum_iter.h"
+#include "ob_fsst_codec.h"
+#include "share/ob_cluster_version.h"
 
 namespace oceanbase
 {
@@ -27,6 +30,9 @@ const int64_t ObCSEncodingUtil::MAX_MICRO_BLOCK_ROW_CNT = 1L << 20; // 1M
 const int64_t ObCSEncodingUtil::DEFAULT_DATA_BUFFER_SIZE = common::OB_DEFAULT_MACRO_BLOCK_SIZE;
 const int64_t ObCSEncodingUtil::MAX_BLOCK_ENCODING_STORE_SIZE = 2 * DEFAULT_DATA_BUFFER_SIZE;
 const int64_t ObCSEncodingUtil::MAX_COLUMN_ENCODING_STORE_SIZE = MAX_BLOCK_ENCODING_STORE_SIZE - 64L * 1024;  // reserved for block header
+const int64_t ObCSEncodingUtil::FSST_MIN_STRING_DATA_SIZE = 1024;
+const int64_t ObCSEncodingUtil::FSST_MIN_DATA_VERSION = DATA_VERSION_4_3_2_0;
+const int64_t ObCSEncodingUtil::FLOAT_MIN_DATA_VERSION = DATA_VERSION_4_3_2_0;
 
 int64_t ObCSEncodingUtil::get_bit_size(const uint64_t v)
 {
@@ -248,5 +254,36 @@ int ObCSEncodingUtil::build_cs_column_encoding_ctx(ObEncodingHashTable *ht,
   return ret;
 }
 
+int ObCSEncodingUtil::try_build_fsst_table(ObIDatumIter &iter, const int64_t str_data_size,
+    ObIAllocator &allocator, ObFSSTSymbolTable &table, uint32_t &code_len, bool &is_fsst_used)
+{
+  int ret = OB_SUCCESS;
+  is_fsst_used = false;
+  code_len = 0;
+  if (str_data_size < FSST_MIN_STRING_DATA_SIZE) {
+    // string data is too small to benefit from fsst
+  } else if (OB_FAIL(table.build(iter, allocator))) {
+    LOG_WARN("fail to build fsst symbol table", K(ret), K(str_data_size));
+  } else {
+    int64_t total_code_len = 0;
+    const ObDatum *datum = nullptr;
+    while (OB_SUCC(ret) && OB_SUCC(iter.get_next(datum))) {
+      if (!datum->is_null()) {
+        total_code_len += table.get_compressed_len(datum->ptr_, datum->len_);
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+    iter.reset();
+    if (OB_SUCC(ret) && (total_code_len + table.get_serialize_size()) * 4 < str_data_size * 3) {
+      is_fsst_used = true;
+      code_len = static_cast<uint32_t>(total_code_len);
+    }
+    LOG_DEBUG("try build fsst table", K(ret), K(str_data_size), K(total_code_len), K(table), K(is_fsst_used));
+  }
+  return ret;
+}
+
 }  // end namespace blocksstable
 }  // end namespace oceanbase
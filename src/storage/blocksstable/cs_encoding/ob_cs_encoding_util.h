@@ -23,6 +23,9 @@ namespace oceanbase
 {
 namespace blocksstable
 {
+class ObIDatumIter;
+class ObFSSTSymbolTable;
+
 class ObCSEncodingUtil
 {
 public:
@@ -32,6 +35,12 @@ public:
   static const int64_t DEFAULT_DATA_BUFFER_SIZE;
   static const int64_t MAX_BLOCK_ENCODING_STORE_SIZE;
   static const int64_t MAX_COLUMN_ENCODING_STORE_SIZE;
+  // string data smaller than this value is not fsst compressed
+  static const int64_t FSST_MIN_STRING_DATA_SIZE;
+  // fsst compressed string stream(OB_STRING_STREAM_META_V2) is only written since this data version
+  static const int64_t FSST_MIN_DATA_VERSION;
+  // FLOAT column encoding is only written since this data version
+  static const int64_t FLOAT_MIN_DATA_VERSION;
 
   static int64_t get_bit_size(const uint64_t v);
   static OB_INLINE int64_t get_bitmap_byte_size(const int64_t bit_cnt)
@@ -70,6 +79,79 @@ public:
   static int build_cs_column_encoding_ctx(ObEncodingHashTable *ht,
     const ObObjTypeStoreClass store_class, const int64_t type_store_size, ObColumnCSEncodingCtx &ctx);
 
+  // train the fsst symbol table with datums of @iter and calculate the total length of codes,
+  // @is_fsst_used is true only if codes and symbol table are less than 3/4 of @str_data_size.
+  static int try_build_fsst_table(ObIDatumIter &iter, const int64_t str_data_size,
+    common::ObIAllocator &allocator, ObFSSTSymbolTable &table, uint32_t &code_len, bool &is_fsst_used);
+
+};
+
+template <typename T>
+struct ObCSFloatTraits;
+
+template <>
+struct ObCSFloatTraits<float>
+{
+  typedef uint32_t UIntType;
+  static const int64_t MAX_EXPONENT = 10;
+  // digits must be exactly representable in the mantissa
+  static OB_INLINE float encode_limit() { return 4194304.0f; /* 2^22 */ }
+};
+
+template <>
+struct ObCSFloatTraits<double>
+{
+  typedef uint64_t UIntType;
+  static const int64_t MAX_EXPONENT = 18;
+  static OB_INLINE double encode_limit() { return 4503599627370496.0; /* 2^52 */ }
+};
+
+// ALP(adaptive lossless floating-point) codec used by FLOAT column encoding.
+// value v is encoded to digit d = round(v * 10^e * 10^-f) and decoded as d * 10^f / 10^e,
+// a value is an exception if the decoded digit is not bitwise identical to it. Dividing by
+// the exact power of ten makes values parsed from short decimal strings roundtrip.
+template <typename T>
+class ObCSFloatCodec
+{
+public:
+  typedef typename ObCSFloatTraits<T>::UIntType UIntType;
+  static const int64_t MAX_EXPONENT = ObCSFloatTraits<T>::MAX_EXPONENT;
+
+  static OB_INLINE const T *exp_arr()
+  {
+    static const T EXP_ARR[] = {
+      1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0, 10000000.0, 100000000.0,
+      1000000000.0, 10000000000.0, 100000000000.0, 1000000000000.0, 10000000000000.0,
+      100000000000000.0, 1000000000000000.0, 10000000000000000.0, 100000000000000000.0,
+      1000000000000000000.0};
+    return EXP_ARR;
+  }
+  static OB_INLINE const T *frac_arr()
+  {
+    static const T FRAC_ARR[] = {
+      1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 0.00000001,
+      0.000000001, 0.0000000001, 0.00000000001, 0.000000000001, 0.0000000000001,
+      0.00000000000001, 0.000000000000001, 0.0000000000000001, 0.00000000000000001,
+      0.000000000000000001};
+    return FRAC_ARR;
+  }
+  static OB_INLINE T decode(const int64_t digit, const uint8_t exponent, const uint8_t factor)
+  {
+    return static_cast<T>(digit) * exp_arr()[factor] / exp_arr()[exponent];
+  }
+  // return false if v is an exception
+  static OB_INLINE bool encode(const T v, const uint8_t exponent, const uint8_t factor, int64_t &digit)
+  {
+    bool is_valid = false;
+    const T tmp = v * exp_arr()[exponent] * frac_arr()[factor];
+    const T limit = ObCSFloatTraits<T>::encode_limit();
+    if (tmp > -limit && tmp < limit) { // also filter NaN and inf
+      digit = static_cast<int64_t>(tmp < 0 ? tmp - static_cast<T>(0.5) : tmp + static_cast<T>(0.5));
+      const T decoded = decode(digit, exponent, factor);
+      is_valid = *reinterpret_cast<const UIntType *>(&decoded) == *reinterpret_cast<const UIntType *>(&v);
+    }
+    return is_valid;
+  }
 };
 
 
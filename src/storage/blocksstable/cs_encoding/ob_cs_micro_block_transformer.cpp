@@ -21,6 +21,7 @@
 #include "storage/blocksstable/ob_sstable_printer.h"
 #include "ob_string_stream_decoder.h"
 #include "ob_integer_stream_decoder.h"
+#include "ob_fsst_codec.h"
 
 namespace oceanbase
 {
@@ -268,6 +269,18 @@ int ObCSMicroBlockTransformer::build_original_transform_desc_(
         stream_row_cnt_arr_[stream_idx] = header_->row_count_;
         pre_streams_len = stream_offsets_arr_[stream_idx] - first_stream_begin_offset;
 
+      } else if (ObCSColumnHeader::Type::FLOAT == column_header.type_) {
+        // float meta and exceptions + digit stream
+        stream_idx = stream_idx + 1;
+        original_desc_.column_first_stream_idx_arr_[i] = stream_idx;
+        original_desc_.column_meta_pos_arr_[i].offset_ = column_meta_begin_offset_ + pre_streams_len;
+        const ObFloatEncodingMeta *float_meta = reinterpret_cast<const ObFloatEncodingMeta *>(
+          payload_buf_ + original_desc_.column_meta_pos_arr_[i].offset_);
+        original_desc_.column_meta_pos_arr_[i].len_ = float_meta->get_column_meta_size();
+        original_desc_.set_is_integer_stream(stream_idx);
+        stream_row_cnt_arr_[stream_idx] = header_->row_count_;
+        pre_streams_len = stream_offsets_arr_[stream_idx] - first_stream_begin_offset;
+
       } else if (ObCSColumnHeader::Type::STRING == column_header.type_) {
         stream_idx = stream_idx + 1;
         original_desc_.column_first_stream_idx_arr_[i] = stream_idx;
@@ -1180,6 +1193,15 @@ int ObCSMicroBlockTransformHelper::build_column_decoder_ctx(
         }
         break;
       }
+      case ObCSColumnHeader::Type::FLOAT : {
+        if (OB_FAIL(build_float_column_decoder_ctx_(obj_meta, col_first_stream_idx,
+            col_end_stream_idx, col_idx, decoder_ctx.float_ctx_))) {
+          LOG_WARN("fail to build_float_column_decoder_ctx", K(ret), K(col_first_stream_idx),
+              K(col_end_stream_idx), K(col_idx),
+              "transform_desc", ObMicroBlockTransformDescPrinter(col_cnt, stream_cnt, transform_desc_));
+        }
+        break;
+      }
       case ObCSColumnHeader::Type::STRING : {
         if (OB_FAIL(build_string_column_decoder_ctx_(obj_meta, col_first_stream_idx,
             col_end_stream_idx, col_idx, decoder_ctx.string_ctx_))) {
@@ -1282,6 +1304,49 @@ int ObCSMicroBlockTransformHelper::build_integer_column_decoder_ctx_(
   return ret;
 }
 
+int ObCSMicroBlockTransformHelper::build_float_column_decoder_ctx_(
+                                  const ObObjMeta &obj_meta,
+                                  const int32_t col_first_stream_idx,
+                                  const int32_t col_end_stream_idx,
+                                  const int32_t col_idx,
+                                  ObFloatColumnDecoderCtx &ctx)
+{
+  int ret = OB_SUCCESS;
+  const char *buf = nullptr;
+  const char *ctx_buf = nullptr;
+
+  if (OB_UNLIKELY(col_end_stream_idx - col_first_stream_idx != 1)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("float must has one stream", K(ret), K(col_first_stream_idx), K(col_end_stream_idx));
+  } else {
+    GET_STREAM_BUF(col_first_stream_idx);
+    if (OB_SUCC(ret)) {
+      const char *meta_buf = get_column_meta(col_idx);
+      ctx.float_meta_ = reinterpret_cast<const ObFloatEncodingMeta *>(meta_buf);
+      ctx.exception_row_ids_ = reinterpret_cast<const uint32_t *>(meta_buf + sizeof(ObFloatEncodingMeta));
+      ctx.exception_values_ = meta_buf + sizeof(ObFloatEncodingMeta)
+          + sizeof(uint32_t) * ctx.float_meta_->exception_cnt_;
+      ctx.datum_len_ = ctx.float_meta_->get_value_size();
+      ctx.ctx_ = reinterpret_cast<const ObIntegerStreamDecoderCtx *>(
+        ctx_buf + transform_desc_.column_first_stream_decoding_ctx_offset_arr_[col_idx]);
+      ctx.data_ = buf + transform_desc_.stream_data_pos_arr_[col_first_stream_idx].offset_;
+      ctx.obj_meta_ = obj_meta;
+      ctx.micro_block_header_ = get_micro_block_header();
+      ctx.col_header_  = &get_column_header(col_idx);
+      ctx.allocator_ = allocator_;
+      if (ctx.ctx_->meta_.is_use_null_replace_value()) {
+        ctx.null_flag_ = ObBaseColumnDecoderCtx::IS_NULL_REPLACED;
+        ctx.null_replaced_value_ = ctx.ctx_->meta_.null_replaced_value_;
+      } else {
+        ctx.null_flag_ = ObBaseColumnDecoderCtx::HAS_NO_NULL;
+        ctx.null_desc_ = nullptr;
+      }
+      LOG_TRACE("build_float_column_decoder_ctx", K(col_first_stream_idx), K(col_end_stream_idx), K(col_idx), K(ctx));
+    }
+  }
+  return ret;
+}
+
 int ObCSMicroBlockTransformHelper::build_string_column_decoder_ctx_(
                                     const ObObjMeta &obj_meta,
                                     const int32_t col_first_stream_idx,
@@ -1332,6 +1397,11 @@ int ObCSMicroBlockTransformHelper::build_string_column_decoder_ctx_(
           ctx.offset_data_ = buf + transform_desc_.stream_data_pos_arr_[col_second_stream_idx].offset_;
         }
       }
+      // fsst codes are decoded lazily by the string column decoder
+      if (OB_SUCC(ret) && ctx.str_ctx_->meta_.is_fsst_compressed() && OB_FAIL(build_fsst_string_decoder_(
+          ctx.str_data_, *ctx.str_ctx_, ctx.offset_data_, ctx.offset_ctx_, ctx.fsst_decoder_))) {
+        LOG_WARN("fail to build fsst string decoder", K(ret), K(col_idx), K(ctx));
+      }
       LOG_TRACE("build_string_column_decoder_ctx", K(col_first_stream_idx), K(col_end_stream_idx), K(col_idx), K(ctx));
     }
   }
@@ -1473,6 +1543,21 @@ int ObCSMicroBlockTransformHelper::build_string_dict_decoder_ctx_(const ObObjMet
                 transform_desc_.column_first_stream_decoding_ctx_offset_arr_[col_idx] +
                 sizeof(ObStringStreamDecoderCtx) + sizeof(ObIntegerStreamDecoderCtx));
             ctx.ref_data_ = buf + transform_desc_.stream_data_pos_arr_[col_third_stream_idx].offset_;
+          }
+          // dict values are few and accessed randomly by refs, so decode them all in advance
+          ObFSSTStringDecoder *fsst_decoder = nullptr;
+          if (OB_FAIL(ret) || !ctx.str_ctx_->meta_.is_fsst_compressed()) {
+          } else if (OB_FAIL(build_fsst_string_decoder_(
+              ctx.str_data_, *ctx.str_ctx_, ctx.offset_data_, ctx.offset_ctx_, fsst_decoder))) {
+            LOG_WARN("fail to build fsst string decoder", K(ret), K(col_idx), K(ctx));
+          } else if (OB_FAIL(fsst_decoder->materialize(*allocator_))) {
+            LOG_WARN("fail to materialize fsst dict", K(ret), K(col_idx), KPC(fsst_decoder));
+          } else {
+            ctx.str_data_ = fsst_decoder->get_decoded_data();
+            ctx.offset_data_ = fsst_decoder->get_decoded_offset_data();
+            ctx.offset_ctx_ = &fsst_decoder->get_decoded_offset_ctx();
+          }
+          if (OB_SUCC(ret)) {
 
             LOG_TRACE("build_string_dict_decoder_ctx",
                 K(col_first_stream_idx), K(col_end_stream_idx), K(col_idx), K(ctx));
@@ -1489,5 +1574,26 @@ int ObCSMicroBlockTransformHelper::build_string_dict_decoder_ctx_(const ObObjMet
 }
 
 
+int ObCSMicroBlockTransformHelper::build_fsst_string_decoder_(
+    const char *str_data,
+    const ObStringStreamDecoderCtx &str_ctx,
+    const char *offset_data,
+    const ObIntegerStreamDecoderCtx *offset_ctx,
+    ObFSSTStringDecoder *&fsst_decoder)
+{
+  int ret = OB_SUCCESS;
+  fsst_decoder = nullptr;
+  if (OB_ISNULL(offset_ctx)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("fsst compressed string must has offset stream", K(ret), K(str_ctx));
+  } else if (OB_ISNULL(fsst_decoder = OB_NEWx(ObFSSTStringDecoder, allocator_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc fsst string decoder", K(ret));
+  } else if (OB_FAIL(fsst_decoder->init(str_data, str_ctx.meta_, offset_data, *offset_ctx))) {
+    LOG_WARN("fail to init fsst string decoder", K(ret), K(str_ctx), KPC(offset_ctx));
+  }
+  return ret;
+}
+
 }  // namespace blocksstable
 }  // namespace oceanbase
@@ -240,6 +240,11 @@ private:
                                         const int32_t col_end_stream_idx,
                                         const int32_t col_idx,
                                         ObIntegerColumnDecoderCtx &ctx);
+  int build_float_column_decoder_ctx_(const ObObjMeta &obj_meta,
+                                      const int32_t col_first_stream_idx,
+                                      const int32_t col_end_stream_idx,
+                                      const int32_t col_idx,
+                                      ObFloatColumnDecoderCtx &ctx);
   int build_string_column_decoder_ctx_(const ObObjMeta &obj_meta,
                                        const int32_t col_first_stream_idx,
                                        const int32_t col_end_stream_idx,
@@ -255,6 +260,11 @@ private:
                                      const int32_t col_end_stream_idx,
                                      const int32_t col_idx,
                                      ObDictColumnDecoderCtx &ctx);
+  int build_fsst_string_decoder_(const char *str_data,
+                                 const ObStringStreamDecoderCtx &str_ctx,
+                                 const char *offset_data,
+                                 const ObIntegerStreamDecoderCtx *offset_ctx,
+                                 ObFSSTStringDecoder *&fsst_decoder);
 
 private:
   bool is_inited_;
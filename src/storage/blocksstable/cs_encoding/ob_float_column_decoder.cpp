@@ -0,0 +1,678 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_column_decoder.h"
+#include "ob_cs_encoding_util.h"
+#include "ob_cs_decoding_util.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
+#include "src/share/vector/ob_fixed_length_vector.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace oceanbase::common;
+
+// return the index in exception array, or -1 if row_id is not an exception
+static OB_INLINE int64_t find_exception_idx(const ObFloatColumnDecoderCtx &ctx, const int64_t row_id)
+{
+  int64_t idx = -1;
+  const uint32_t exception_cnt = ctx.float_meta_->exception_cnt_;
+  if (exception_cnt > 0) {
+    const uint32_t *end = ctx.exception_row_ids_ + exception_cnt;
+    const uint32_t *pos = std::lower_bound(ctx.exception_row_ids_, end, static_cast<uint32_t>(row_id));
+    if (pos != end && *pos == row_id) {
+      idx = pos - ctx.exception_row_ids_;
+    }
+  }
+  return idx;
+}
+
+// datum.ptr_ must point to a buffer which can hold sizeof(T) bytes
+template <typename T>
+static OB_INLINE void decode_float_datum(
+    const ObFloatColumnDecoderCtx &ctx, const int64_t row_id, ObDatum &datum)
+{
+  const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+  const uint32_t width_size = stream_meta.get_uint_width_size();
+  uint64_t digit = 0;
+  int64_t exception_idx = -1;
+  ENCODING_ADAPT_MEMCPY(&digit, ctx.data_ + row_id * width_size, width_size);
+  digit += stream_meta.is_use_base() * stream_meta.base_value_;
+  if (ctx.is_null_replaced() && digit == static_cast<uint64_t>(ctx.null_replaced_value_)) {
+    datum.set_null();
+  } else {
+    if ((exception_idx = find_exception_idx(ctx, row_id)) >= 0) {
+      MEMCPY(const_cast<char *>(datum.ptr_), ctx.exception_values_ + exception_idx * sizeof(T), sizeof(T));
+    } else {
+      *reinterpret_cast<T *>(const_cast<char *>(datum.ptr_)) = ObCSFloatCodec<T>::decode(
+          static_cast<int64_t>(digit), ctx.float_meta_->exponent_, ctx.float_meta_->factor_);
+    }
+    datum.pack_ = sizeof(T);
+  }
+}
+
+//============================ DecodeFloatToVec_T ======================================//
+// Decode digits to ObFixedLengthFormat in a tight loop which can be vectorized by compiler,
+// the null rows and exception rows are patched afterwards.
+template<typename ValueType, int32_t store_len_V, int32_t is_null_replaced_V>
+struct DecodeFloatToVec_T
+{
+  static void process(
+      const ObFloatColumnDecoderCtx &ctx,
+      ObVectorDecodeCtx &vector_ctx,
+      ObFixedLengthFormat<ValueType> &vector)
+  {
+    typedef typename ObCSEncodingStoreTypeInference<store_len_V>::Type StoreIntType;
+    const StoreIntType *store_uint_arr = reinterpret_cast<const StoreIntType*>(ctx.data_);
+    ValueType *vec_value_arr = reinterpret_cast<ValueType*>(vector.get_data()) + vector_ctx.vec_offset_;
+    const uint64_t base = ctx.ctx_->meta_.is_use_base() * ctx.ctx_->meta_.base_value_;
+    const ValueType mul = ObCSFloatCodec<ValueType>::exp_arr()[ctx.float_meta_->factor_];
+    const ValueType div = ObCSFloatCodec<ValueType>::exp_arr()[ctx.float_meta_->exponent_];
+    const int64_t *row_ids = vector_ctx.row_ids_;
+    const int64_t row_cap = vector_ctx.row_cap_;
+
+    for (int64_t i = 0; i < row_cap; i++) {
+      const int64_t digit = static_cast<int64_t>(store_uint_arr[row_ids[i]] + base);
+      vec_value_arr[i] = static_cast<ValueType>(digit) * mul / div;
+    }
+    if (is_null_replaced_V) {
+      const StoreIntType null_store_val = static_cast<StoreIntType>(ctx.null_replaced_value_ - base);
+      for (int64_t i = 0; i < row_cap; i++) {
+        if (store_uint_arr[row_ids[i]] == null_store_val) {
+          vector.set_null(vector_ctx.vec_offset_ + i);
+        }
+      }
+    }
+    const uint32_t exception_cnt = ctx.float_meta_->exception_cnt_;
+    if (exception_cnt > 0) {
+      const ValueType *exception_values = reinterpret_cast<const ValueType *>(ctx.exception_values_);
+      int64_t exception_idx = -1;
+      for (int64_t i = 0; i < row_cap; i++) {
+        if ((exception_idx = find_exception_idx(ctx, row_ids[i])) >= 0) {
+          MEMCPY(vec_value_arr + i, exception_values + exception_idx, sizeof(ValueType));
+        }
+      }
+    }
+  }
+};
+
+using DecodeFloatToVecFunc = void (*)(
+    const ObFloatColumnDecoderCtx &ctx,
+    ObVectorDecodeCtx &vector_ctx,
+    ObIVector &vector);
+
+template<typename ValueType, int32_t store_len_V, int32_t is_null_replaced_V>
+static void decode_float_to_vec(
+    const ObFloatColumnDecoderCtx &ctx,
+    ObVectorDecodeCtx &vector_ctx,
+    ObIVector &vector)
+{
+  DecodeFloatToVec_T<ValueType, store_len_V, is_null_replaced_V>::process(
+      ctx, vector_ctx, static_cast<ObFixedLengthFormat<ValueType> &>(vector));
+}
+
+static ObMultiDimArray_T<DecodeFloatToVecFunc, 2/*is_float*/, 4/*store_len*/, 2/*is_null_replaced*/>
+    decode_float_to_vec_funcs;
+
+template <int32_t is_float_V, int32_t store_len_V, int32_t is_null_replaced_V>
+struct DecodeFloatToVec_T_Init
+{
+  bool operator()()
+  {
+    typedef typename std::conditional<is_float_V, float, double>::type ValueType;
+    decode_float_to_vec_funcs[is_float_V][store_len_V][is_null_replaced_V]
+      = &(decode_float_to_vec<ValueType, store_len_V, is_null_replaced_V>);
+    return true;
+  }
+};
+
+static bool decode_float_to_vec_funcs_inited
+    = ObNDArrayIniter<DecodeFloatToVec_T_Init, 2, 4, 2>::apply();
+
+//============================ FilterFloatDigit_T ======================================//
+// result[i] = ((lower <= digit < upper) ^ is_negative) && digit != null_digit
+template <int32_t store_len_V>
+struct FilterFloatDigit_T
+{
+  static void process(
+      const char *data,
+      const uint64_t base,
+      const int64_t row_start,
+      const int64_t row_count,
+      const int64_t lower,
+      const int64_t upper,
+      const bool is_negative,
+      const int64_t null_digit,
+      uint8_t *result)
+  {
+    typedef typename ObCSEncodingStoreTypeInference<store_len_V>::Type StoreIntType;
+    const StoreIntType *store_uint_arr = reinterpret_cast<const StoreIntType*>(data) + row_start;
+    const uint8_t negative = is_negative;
+    for (int64_t i = 0; i < row_count; i++) {
+      const int64_t digit = static_cast<int64_t>(store_uint_arr[i] + base);
+      result[i] = (((digit >= lower) & (digit < upper)) ^ negative) & (digit != null_digit);
+    }
+  }
+};
+
+using FilterFloatDigitFunc = void (*)(
+    const char *data,
+    const uint64_t base,
+    const int64_t row_start,
+    const int64_t row_count,
+    const int64_t lower,
+    const int64_t upper,
+    const bool is_negative,
+    const int64_t null_digit,
+    uint8_t *result);
+
+static ObMultiDimArray_T<FilterFloatDigitFunc, 4/*store_len*/> filter_float_digit_funcs;
+
+template <int32_t store_len_V>
+struct FilterFloatDigit_T_Init
+{
+  bool operator()()
+  {
+    filter_float_digit_funcs[store_len_V] = &(FilterFloatDigit_T<store_len_V>::process);
+    return true;
+  }
+};
+
+static bool filter_float_digit_funcs_inited
+    = ObNDArrayIniter<FilterFloatDigit_T_Init, 4>::apply();
+
+// Decoded value is monotonic with digit, return the minimal digit whose decoded value
+// is >= v (or > v if is_upper). Stored digits are in [-limit, limit], so max_digit is
+// returned if no such digit and -max_digit means all digits match.
+template <typename T>
+static int64_t get_digit_bound(const T v, const uint8_t exponent, const uint8_t factor, const bool is_upper)
+{
+  const T limit = ObCSFloatTraits<T>::encode_limit();
+  const int64_t max_digit = static_cast<int64_t>(limit) + 1;
+  const T tmp = v * ObCSFloatCodec<T>::exp_arr()[exponent] * ObCSFloatCodec<T>::frac_arr()[factor];
+  int64_t digit = 0;
+  if (!(tmp > -limit)) {
+    digit = -max_digit;
+  } else if (!(tmp < limit)) {
+    digit = max_digit;
+  } else {
+    digit = static_cast<int64_t>(tmp);
+  }
+#define IS_MATCH(d) \
+  (is_upper ? ObCSFloatCodec<T>::decode(d, exponent, factor) > v : ObCSFloatCodec<T>::decode(d, exponent, factor) >= v)
+  while (digit > -max_digit && IS_MATCH(digit - 1)) {
+    digit--;
+  }
+  while (digit < max_digit && !IS_MATCH(digit)) {
+    digit++;
+  }
+#undef IS_MATCH
+  return digit;
+}
+
+//============================ ObFloatColumnDecoder ======================================//
+int ObFloatColumnDecoder::decode(const ObColumnCSDecoderCtx &ctx,
+                                 const int64_t row_id,
+                                 common::ObDatum &datum) const
+{
+  int ret = OB_SUCCESS;
+  const ObFloatColumnDecoderCtx &float_ctx = ctx.float_ctx_;
+  if (float_ctx.float_meta_->is_float()) {
+    decode_float_datum<float>(float_ctx, row_id, datum);
+  } else {
+    decode_float_datum<double>(float_ctx, row_id, datum);
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::batch_decode(const ObColumnCSDecoderCtx &ctx,
+    const int64_t *row_ids, const int64_t row_cap, common::ObDatum *datums) const
+{
+  int ret = OB_SUCCESS;
+  const ObFloatColumnDecoderCtx &float_ctx = ctx.float_ctx_;
+  if (float_ctx.float_meta_->is_float()) {
+    for (int64_t i = 0; i < row_cap; i++) {
+      decode_float_datum<float>(float_ctx, row_ids[i], datums[i]);
+    }
+  } else {
+    for (int64_t i = 0; i < row_cap; i++) {
+      decode_float_datum<double>(float_ctx, row_ids[i], datums[i]);
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::decode_vector(
+    const ObColumnCSDecoderCtx &ctx, ObVectorDecodeCtx &vector_ctx) const
+{
+  int ret = OB_SUCCESS;
+  const ObFloatColumnDecoderCtx &float_ctx = ctx.float_ctx_;
+  const VectorFormat vec_format = vector_ctx.get_format();
+  // float and double are fixed length types, the sql layer only use ObFixedLengthFormat
+  if (OB_UNLIKELY(VEC_FIXED != vec_format)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("float column not support decoding to this vector format", K(ret), K(vec_format), K(float_ctx));
+  } else {
+    DecodeFloatToVecFunc decode_func = decode_float_to_vec_funcs
+        [float_ctx.float_meta_->is_float()]
+        [float_ctx.ctx_->meta_.get_width_tag()]
+        [float_ctx.is_null_replaced()];
+    decode_func(float_ctx, vector_ctx, *vector_ctx.get_vector());
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::get_null_count(
+    const ObColumnCSDecoderCtx &col_ctx,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  null_count = 0;
+  const ObFloatColumnDecoderCtx &float_ctx = col_ctx.float_ctx_;
+  if (float_ctx.is_null_replaced()) {
+    const ObIntegerStreamMeta &stream_meta = float_ctx.ctx_->meta_;
+    const uint32_t width_size = stream_meta.get_uint_width_size();
+    const uint64_t base_val = stream_meta.is_use_base() * stream_meta.base_value_;
+    const uint64_t null_val = float_ctx.null_replaced_value_ - base_val;
+    uint64_t cur_val = 0;
+    for (int64_t i = 0; i < row_cap; ++i) {
+      ENCODING_ADAPT_MEMCPY(&cur_val, float_ctx.data_ + row_ids[i] * width_size, width_size);
+      if (cur_val == null_val) {
+        ++null_count;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnCSDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(parent);
+  int ret = OB_SUCCESS;
+  const ObFloatColumnDecoderCtx &float_ctx = col_ctx.float_ctx_;
+  const int64_t row_cnt = pd_filter_info.count_;
+  if (OB_UNLIKELY(row_cnt < 1 || row_cnt != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(row_cnt), K(result_bitmap.size()));
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    switch (op_type) {
+      case sql::WHITE_OP_NU:
+      case sql::WHITE_OP_NN: {
+        if (OB_FAIL(nu_nn_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle nu_nn operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_EQ:
+      case sql::WHITE_OP_NE:
+      case sql::WHITE_OP_GT:
+      case sql::WHITE_OP_GE:
+      case sql::WHITE_OP_LT:
+      case sql::WHITE_OP_LE:
+      case sql::WHITE_OP_BT: {
+        if (OB_FAIL(comparison_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle comparison operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_IN: {
+        if (OB_FAIL(in_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle in operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      default: {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("unexpected operation type", KR(ret), K(op_type));
+      }
+    }
+    LOG_TRACE("float white filter pushdown", K(ret), K(float_ctx),
+        K(filter.get_op_type()), K(pd_filter_info), K(result_bitmap.popcnt()));
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::nu_nn_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const bool is_nn = sql::WHITE_OP_NN == filter.get_op_type();
+  if (!ctx.is_null_replaced()) {
+    result_bitmap.reuse(is_nn);
+  } else {
+    // transform 'x is null' to 'digit == null_replaced_value', exceptions are never null
+    const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+    filter_float_digit_funcs[stream_meta.get_width_tag()](
+        ctx.data_,
+        stream_meta.is_use_base() * stream_meta.base_value_,
+        pd_filter_info.start_,
+        pd_filter_info.count_,
+        ctx.null_replaced_value_,
+        ctx.null_replaced_value_ + 1,
+        is_nn,
+        INT64_MAX/*no null digit*/,
+        result_bitmap.get_data());
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::can_filter_on_digits(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    bool &can_filter)
+{
+  int ret = OB_SUCCESS;
+  can_filter = false;
+  const sql::ObExpr *expr = filter.get_filter_node().expr_;
+  const ObObjTypeClass store_tc = ob_obj_type_class(ctx.col_header_->get_store_obj_type());
+  const ObScale col_scale = ctx.obj_meta_.get_scale();
+  if (OB_ISNULL(expr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null filter expr", K(ret), K(filter));
+  } else if (ctx.obj_meta_.get_type_class() != store_tc) {
+    // column need cast, compare with datum
+  } else if (col_scale > SCALE_UNKNOWN_YET && col_scale <= OB_MAX_DOUBLE_FLOAT_SCALE) {
+    // fixed scale float/double is compared with precision, not by value
+  } else {
+    can_filter = true;
+    // BT has two filter values, so check every value expr instead of get_filter_val_meta
+    for (int64_t i = 0; OB_SUCC(ret) && can_filter && i < expr->arg_cnt_; i++) {
+      if (OB_ISNULL(expr->args_[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null filter expr argument", K(ret), K(i));
+      } else if (T_REF_COLUMN != expr->args_[i]->type_) {
+        // filter value need cast, compare with datum
+        can_filter = expr->args_[i]->obj_meta_.get_type_class() == store_tc;
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && can_filter && i < filter.get_datums().count(); i++) {
+      const ObDatum &datum = filter.get_datums().at(i);
+      if (datum.is_null()) {
+        can_filter = false;
+      } else if (ObFloatTC == store_tc) {
+        can_filter = !std::isnan(datum.get_float());
+      } else {
+        can_filter = !std::isnan(datum.get_double());
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::comparison_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const int64_t datums_cnt = filter.get_datums().count();
+  bool can_filter = false;
+  if (OB_UNLIKELY(datums_cnt != (sql::WHITE_OP_BT == op_type ? 2 : 1))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datums_cnt), K(op_type));
+  } else if (OB_FAIL(can_filter_on_digits(ctx, filter, can_filter))) {
+    LOG_WARN("fail to check whether can filter on digits", KR(ret));
+  } else if (can_filter) {
+    if (ctx.float_meta_->is_float()) {
+      ret = tranverse_digit_comparison_op<float>(ctx, filter, pd_filter_info, result_bitmap);
+    } else {
+      ret = tranverse_digit_comparison_op<double>(ctx, filter, pd_filter_info, result_bitmap);
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("fail to tranverse digit comparison op", KR(ret), K(ctx), K(op_type));
+    }
+  } else {
+    ObFunction<int(const ObDatum &cur_datum, const int64_t idx)> eval =
+    [&] (const ObDatum &cur_datum, const int64_t idx)
+    {
+      int tmp_ret = OB_SUCCESS;
+      bool is_true = false;
+      if (OB_TMP_FAIL(compare_datum(filter, cur_datum, is_true))) {
+        LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(filter.get_datums()));
+      } else if (is_true && OB_TMP_FAIL(result_bitmap.set(idx))) {
+        LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+      }
+      return tmp_ret;
+    };
+    if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+      LOG_WARN("fail to traverse datum in cmp_op", KR(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+template<typename T>
+int ObFloatColumnDecoder::tranverse_digit_comparison_op(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const uint8_t e = ctx.float_meta_->exponent_;
+  const uint8_t f = ctx.float_meta_->factor_;
+  const T left = *reinterpret_cast<const T *>(filter.get_datums().at(0).ptr_);
+  int64_t lower = INT64_MIN;
+  int64_t upper = INT64_MAX;
+  bool is_negative = false;
+  switch (filter.get_op_type()) {
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE: {
+      lower = get_digit_bound(left, e, f, false);
+      upper = get_digit_bound(left, e, f, true);
+      is_negative = sql::WHITE_OP_NE == filter.get_op_type();
+      break;
+    }
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_LE: {
+      lower = get_digit_bound(left, e, f, true);
+      is_negative = sql::WHITE_OP_LE == filter.get_op_type();
+      break;
+    }
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT: {
+      lower = get_digit_bound(left, e, f, false);
+      is_negative = sql::WHITE_OP_LT == filter.get_op_type();
+      break;
+    }
+    case sql::WHITE_OP_BT: {
+      const T right = *reinterpret_cast<const T *>(filter.get_datums().at(1).ptr_);
+      lower = get_digit_bound(left, e, f, false);
+      upper = get_digit_bound(right, e, f, true);
+      break;
+    }
+    default: {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected operator type", KR(ret), K(filter.get_op_type()));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+    filter_float_digit_funcs[stream_meta.get_width_tag()](
+        ctx.data_,
+        stream_meta.is_use_base() * stream_meta.base_value_,
+        pd_filter_info.start_,
+        pd_filter_info.count_,
+        lower,
+        upper,
+        is_negative,
+        ctx.is_null_replaced() ? ctx.null_replaced_value_ : INT64_MAX,
+        result_bitmap.get_data());
+    if (OB_FAIL(check_exception_rows(ctx, filter, pd_filter_info, result_bitmap))) {
+      LOG_WARN("fail to check exception rows", KR(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::check_exception_rows(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const uint32_t exception_cnt = ctx.float_meta_->exception_cnt_;
+  if (exception_cnt > 0) {
+    const int64_t row_start = pd_filter_info.start_;
+    const int64_t row_end = pd_filter_info.start_ + pd_filter_info.count_;
+    const int64_t value_size = ctx.float_meta_->get_value_size();
+    const uint32_t *end = ctx.exception_row_ids_ + exception_cnt;
+    const uint32_t *pos = std::lower_bound(ctx.exception_row_ids_, end, static_cast<uint32_t>(row_start));
+    ObDatum cur_datum;
+    bool is_true = false;
+    for (; OB_SUCC(ret) && pos != end && *pos < row_end; ++pos) {
+      cur_datum.ptr_ = ctx.exception_values_ + (pos - ctx.exception_row_ids_) * value_size;
+      cur_datum.pack_ = value_size;
+      if (OB_FAIL(compare_datum(filter, cur_datum, is_true))) {
+        LOG_WARN("fail to compare datums", K(ret), K(cur_datum), K(filter.get_datums()));
+      } else if (OB_FAIL(result_bitmap.set(*pos - row_start, is_true))) {
+        LOG_WARN("fail to set result bitmap", KR(ret), K(*pos), K(row_start));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::compare_datum(
+    const sql::ObWhiteFilterExecutor &filter,
+    const ObDatum &cur_datum,
+    bool &is_true)
+{
+  int ret = OB_SUCCESS;
+  ObDatumCmpFuncType type_cmp_func = filter.cmp_func_;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  int cmp_ret = 0;
+  is_true = false;
+  if (sql::WHITE_OP_BT == op_type) {
+    if (OB_FAIL(type_cmp_func(cur_datum, filter.get_datums().at(0), cmp_ret))) {
+      LOG_WARN("fail to compare datums", K(ret), K(cur_datum), K(filter.get_datums()));
+    } else if (!get_filter_cmp_ret_func(sql::WHITE_OP_GE)(cmp_ret)) {
+      // skip
+    } else if (OB_FAIL(type_cmp_func(cur_datum, filter.get_datums().at(1), cmp_ret))) {
+      LOG_WARN("fail to compare datums", K(ret), K(cur_datum), K(filter.get_datums()));
+    } else {
+      is_true = get_filter_cmp_ret_func(sql::WHITE_OP_LE)(cmp_ret);
+    }
+  } else if (OB_FAIL(type_cmp_func(cur_datum, filter.get_datums().at(0), cmp_ret))) {
+    LOG_WARN("fail to compare datums", K(ret), K(cur_datum), K(filter.get_datums()));
+  } else {
+    is_true = get_filter_cmp_ret_func(op_type)(cmp_ret);
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::in_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datum_cnt = 0;
+  if (OB_UNLIKELY((datum_cnt = (filter.get_datums().count())) < 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datum_cnt));
+  } else {
+    ObFilterInCmpType cmp_type = get_filter_in_cmp_type(pd_filter_info.count_, filter.get_datums().count(), false);
+    ObFunction<int(const ObDatum &cur_datum, const int64_t idx)> eval;
+    if (cmp_type == ObFilterInCmpType::BINARY_SEARCH) {
+      eval = [&] (const ObDatum &cur_datum, const int64_t idx)
+      {
+        int tmp_ret = OB_SUCCESS;
+        bool is_exist = false;
+        if (OB_TMP_FAIL(filter.exist_in_datum_array(cur_datum, is_exist))) {
+          LOG_WARN("fail to check datum in array", KR(tmp_ret), K(cur_datum));
+        } else if (is_exist) {
+          if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+            LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+          }
+        }
+        return tmp_ret;
+      };
+    } else if (cmp_type == ObFilterInCmpType::HASH_SEARCH) {
+      eval = [&] (const ObDatum &cur_datum, const int64_t idx)
+      {
+        int tmp_ret = OB_SUCCESS;
+        bool is_exist = false;
+        if (OB_TMP_FAIL(filter.exist_in_datum_set(cur_datum, is_exist))) {
+          LOG_WARN("fail to check datum in hashset", KR(tmp_ret), K(cur_datum));
+        } else if (is_exist) {
+          if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+            LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+          }
+        }
+        return tmp_ret;
+      };
+    } else {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected filter in compare type", KR(ret), K(cmp_type));
+    }
+
+    if (OB_SUCC(ret) && OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+      LOG_WARN("fail to tranverse datum in in_op", KR(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+template<typename Operator>
+int ObFloatColumnDecoder::tranverse_datum_all_op(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap,
+    Operator const &eval)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  const bool is_float = ctx.float_meta_->is_float();
+  uint64_t datum_buf = 0;
+  ObDatum cur_datum;
+  // NU/NN will not reach here.
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    const int64_t row_id = row_start + i;
+    cur_datum.ptr_ = reinterpret_cast<const char *>(&datum_buf);
+    if (is_float) {
+      decode_float_datum<float>(ctx, row_id, cur_datum);
+    } else {
+      decode_float_datum<double>(ctx, row_id, cur_datum);
+    }
+    if (cur_datum.is_null()) {
+      // cur_datum is null, directly set result_bitmap
+      if (OB_FAIL(result_bitmap.set(i, false))) {
+        LOG_WARN("fail to set result bitmap", KR(ret), K(i));
+      }
+    } else if (OB_FAIL(eval(cur_datum, i))) {
+      LOG_WARN("fail to exe eval", KR(ret), K(i), K(cur_datum));
+    }
+  }
+  return ret;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
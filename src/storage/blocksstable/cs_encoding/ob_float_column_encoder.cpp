@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_column_encoder.h"
+#include "ob_cs_encoding_util.h"
+#include "ob_column_datum_iter.h"
+#include "lib/codec/ob_codecs.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+ObFloatColumnEncoder::ObFloatColumnEncoder()
+  : float_meta_(),
+    digits_(nullptr),
+    exception_row_ids_(nullptr),
+    enc_ctx_(),
+    integer_stream_encoder_(),
+    integer_range_(0)
+{
+}
+
+ObFloatColumnEncoder::~ObFloatColumnEncoder() {}
+
+int ObFloatColumnEncoder::init(
+  const ObColumnCSEncodingCtx &ctx, const int64_t column_index, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnCSEncoder::init(ctx, column_index, row_count))) {
+    LOG_WARN("init base column encoder failed", K(ret), K(ctx), K(column_index), K(row_count));
+  } else {
+    column_header_.type_ = type_;
+    column_header_.set_is_fixed_length();
+    const ObObjTypeClass tc = column_type_.get_type_class();
+    if (ObFloatTC == tc) {
+      float_meta_.set_is_float();
+      ret = do_init_<float>();
+    } else if (ObDoubleTC == tc) {
+      ret = do_init_<double>();
+    } else {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type class", K(ret), K_(column_type), K_(column_index));
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("fail to do init", K(ret));
+    } else {
+      LOG_DEBUG("init float column encoder", K(ret), K_(column_type), K_(column_index), K_(float_meta));
+    }
+  }
+  return ret;
+}
+
+void ObFloatColumnEncoder::reuse()
+{
+  ObIColumnCSEncoder::reuse();
+  float_meta_.reuse();
+  digits_ = nullptr;
+  exception_row_ids_ = nullptr;
+  integer_stream_encoder_.reuse();
+  integer_range_ = 0;
+  enc_ctx_.reset();
+}
+
+template <typename T>
+void ObFloatColumnEncoder::choose_exponent_and_factor_()
+{
+  // choose the exponent and factor which has the minimal estimated bits of sampled values
+  T samples[MAX_SAMPLE_COUNT];
+  int64_t sample_cnt = 0;
+  const int64_t step = MAX(1, row_count_ / MAX_SAMPLE_COUNT);
+  for (int64_t i = 0; i < row_count_ && sample_cnt < MAX_SAMPLE_COUNT; i += step) {
+    const ObDatum &datum = ctx_->col_datums_->at(i);
+    if (!datum.is_null()) {
+      samples[sample_cnt++] = *reinterpret_cast<const T *>(datum.ptr_);
+    }
+  }
+  int64_t best_cost = INT64_MAX;
+  for (uint8_t e = 0; e <= ObCSFloatCodec<T>::MAX_EXPONENT; e++) {
+    for (uint8_t f = 0; f <= e; f++) {
+      int64_t exception_cnt = 0;
+      int64_t min = INT64_MAX;
+      int64_t max = INT64_MIN;
+      int64_t digit = 0;
+      for (int64_t i = 0; i < sample_cnt; i++) {
+        if (ObCSFloatCodec<T>::encode(samples[i], e, f, digit)) {
+          min = MIN(min, digit);
+          max = MAX(max, digit);
+        } else {
+          exception_cnt++;
+        }
+      }
+      const int64_t bit_size = min > max ? 0 : ObCSEncodingUtil::get_bit_size(max - min);
+      const int64_t cost = exception_cnt * (sizeof(T) + sizeof(uint32_t)) * CHAR_BIT
+          + (sample_cnt - exception_cnt) * bit_size;
+      if (cost < best_cost) {
+        best_cost = cost;
+        float_meta_.exponent_ = e;
+        float_meta_.factor_ = f;
+      }
+    }
+  }
+}
+
+template <typename T>
+int ObFloatColumnEncoder::do_init_()
+{
+  int ret = OB_SUCCESS;
+  const ObColDatums &col_datums = *ctx_->col_datums_;
+  if (OB_ISNULL(digits_ = static_cast<int64_t *>(ctx_->allocator_->alloc(sizeof(int64_t) * row_count_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc digits", K(ret), K_(row_count));
+  } else if (OB_ISNULL(exception_row_ids_ = static_cast<uint32_t *>(
+      ctx_->allocator_->alloc(sizeof(uint32_t) * row_count_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc exception row ids", K(ret), K_(row_count));
+  } else {
+    if (row_count_ != ctx_->null_cnt_) {
+      choose_exponent_and_factor_<T>();
+    }
+    const uint8_t e = float_meta_.exponent_;
+    const uint8_t f = float_meta_.factor_;
+    uint32_t exception_cnt = 0;
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    for (int64_t i = 0; i < row_count_; i++) {
+      const ObDatum &datum = col_datums.at(i);
+      if (datum.is_null()) {
+        digits_[i] = 0;
+      } else if (ObCSFloatCodec<T>::encode(*reinterpret_cast<const T *>(datum.ptr_), e, f, digits_[i])) {
+        min = MIN(min, digits_[i]);
+        max = MAX(max, digits_[i]);
+      } else {
+        exception_row_ids_[exception_cnt++] = static_cast<uint32_t>(i);
+      }
+    }
+    if (min > max) { // all datums are null or exception
+      min = 0;
+      max = 0;
+    }
+    // exception rows use min digit to occupy the position
+    for (uint32_t i = 0; i < exception_cnt; i++) {
+      digits_[exception_row_ids_[i]] = min;
+    }
+    float_meta_.exception_cnt_ = exception_cnt;
+
+    // digits are in (-2^52, 2^52), so min - 1 is always available for null
+    const bool has_null = ctx_->null_cnt_ > 0;
+    if (OB_FAIL(enc_ctx_.build_signed_stream_meta(has_null ? min - 1 : min, max,
+        has_null/*is_replace_null*/, min - 1, -1/*precision_width_size*/, is_force_raw_, integer_range_))) {
+      LOG_WARN("fail to build_signed_stream_meta", K(ret), K(min), K(max));
+    } else {
+      int_stream_count_ = 1;
+      if (OB_FAIL(enc_ctx_.build_stream_encoder_info(
+          has_null,
+          false/*not monotonic*/,
+          &ctx_->encoding_ctx_->cs_encoding_opt_,
+          ctx_->encoding_ctx_->previous_cs_encoding_.get_column_encoding(column_index_),
+          0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
+        LOG_WARN("fail to build_stream_encoder_info", K(ret));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObFloatColumnEncoder::store_column(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    // first stream offset include the column meta
+    if (OB_FAIL(store_column_meta_(buf_writer))) {
+      LOG_WARN("fail to store column meta", K(ret));
+    } else {
+      ObFloatDigitDatumIter iter(*ctx_->col_datums_, digits_);
+      if (OB_FAIL(integer_stream_encoder_.encode(enc_ctx_, iter, buf_writer))) {
+        LOG_WARN("fail to encode stream", K(ret), K(enc_ctx_));
+      } else if (OB_FAIL(stream_offsets_.push_back(buf_writer.length()))) {
+        LOG_WARN("fail to push back", K(ret));
+      } else {
+        int_stream_encoding_types_[0] = enc_ctx_.meta_.get_encoding_type();
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObFloatColumnEncoder::store_column_meta_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  const int64_t value_size = float_meta_.get_value_size();
+  if (OB_FAIL(buf_writer.write(&float_meta_, sizeof(ObFloatEncodingMeta)))) {
+    LOG_WARN("fail to write float meta", K(ret), K_(float_meta));
+  } else if (float_meta_.exception_cnt_ > 0 && OB_FAIL(buf_writer.write(
+      exception_row_ids_, sizeof(uint32_t) * float_meta_.exception_cnt_))) {
+    LOG_WARN("fail to write exception row ids", K(ret), K_(float_meta));
+  } else {
+    for (uint32_t i = 0; OB_SUCC(ret) && i < float_meta_.exception_cnt_; i++) {
+      const ObDatum &datum = ctx_->col_datums_->at(exception_row_ids_[i]);
+      if (OB_FAIL(buf_writer.write(datum.ptr_, value_size))) {
+        LOG_WARN("fail to write exception value", K(ret), K(i), K(datum));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int64_t ObFloatColumnEncoder::estimate_store_size() const
+{
+  int64_t size = INT64_MAX;
+  if (!is_inited_) {
+  } else if (is_force_raw_) {
+  } else {
+    size = ObCSEncodingUtil::get_bit_size(integer_range_) * row_count_ / CHAR_BIT
+        + float_meta_.get_column_meta_size();
+  }
+
+  return size;
+}
+
+int ObFloatColumnEncoder::get_identifier_and_stream_types(
+    ObColumnEncodingIdentifier &identifier, const ObIntegerStream::EncodingType *&types) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    identifier.set(type_, int_stream_count_, 0);
+    types = int_stream_encoding_types_;
+  }
+  return ret;
+}
+
+int ObFloatColumnEncoder::get_maximal_encoding_store_size(int64_t &size) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    size = sizeof(ObIntegerStreamMeta) + float_meta_.get_column_meta_size() +
+        common::ObCodec::get_moderate_encoding_size(enc_ctx_.meta_.get_uint_width_size() * row_count_);
+    size = std::min(size, ObCSEncodingUtil::MAX_COLUMN_ENCODING_STORE_SIZE);
+  }
+  return ret;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_fsst_codec.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+//============================ ObFSSTSymbolTable ==============================//
+
+void ObFSSTSymbolTable::reset()
+{
+  MEMSET(symbols_, 0, sizeof(symbols_));
+  MEMSET(lens_, 0, sizeof(lens_));
+  symbol_cnt_ = 0;
+  MEMSET(index_, 0, sizeof(index_));
+  MEMSET(sorted_codes_, 0, sizeof(sorted_codes_));
+}
+
+int ObFSSTSymbolTable::build(ObIDatumIter &iter, ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  ObString *samples = nullptr;
+  Candidate *candidates = nullptr;
+  Candidate *sorted = nullptr;
+  reset();
+  if (OB_UNLIKELY(iter.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("datum iter is empty", K(ret));
+  } else if (OB_ISNULL(samples = static_cast<ObString *>(allocator.alloc(sizeof(ObString) * iter.size())))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc samples", K(ret), K(iter.size()));
+  } else if (OB_ISNULL(candidates = static_cast<Candidate *>(
+      allocator.alloc(sizeof(Candidate) * CANDIDATE_BUCKET_CNT * 2)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc candidates", K(ret));
+  } else {
+    sorted = candidates + CANDIDATE_BUCKET_CNT;
+    int64_t sample_cnt = 0;
+    int64_t sample_size = 0;
+    const ObDatum *datum = nullptr;
+    iter.reset();
+    while (OB_SUCC(ret) && sample_size < MAX_SAMPLE_SIZE && OB_SUCC(iter.get_next(datum))) {
+      if (!datum->is_null() && datum->len_ > 0) {
+        const int64_t len = MIN(datum->len_, MAX_SAMPLE_SIZE - sample_size);
+        samples[sample_cnt++].assign_ptr(datum->ptr_, static_cast<int32_t>(len));
+        sample_size += len;
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+    iter.reset();
+    // symbols grow from single bytes to concatenations of the frequent symbols of last round
+    for (int64_t round = 0; OB_SUCC(ret) && round < TRAIN_ROUND; ++round) {
+      if (OB_FAIL(train_round_(samples, sample_cnt, candidates, sorted))) {
+        LOG_WARN("fail to train symbol table", K(ret), K(round), K(sample_cnt));
+      }
+    }
+    LOG_DEBUG("build fsst symbol table", K(ret), K(sample_cnt), K(sample_size), K_(symbol_cnt));
+  }
+  return ret;
+}
+
+void ObFSSTSymbolTable::add_candidate_(
+    Candidate *candidates, int64_t &candidate_cnt, const uint64_t symbol, const int64_t len)
+{
+  // keep at least a quarter of buckets empty so that the probing always stops
+  static const int64_t MAX_CANDIDATE_CNT = CANDIDATE_BUCKET_CNT * 3 / 4;
+  const uint64_t hash = (symbol * 0x9E3779B97F4A7C15ULL) ^ static_cast<uint64_t>(len);
+  int64_t idx = static_cast<int64_t>(hash >> 52) & (CANDIDATE_BUCKET_CNT - 1);
+  bool done = false;
+  while (!done) {
+    Candidate &candidate = candidates[idx];
+    if (0 == candidate.len_) {
+      if (candidate_cnt < MAX_CANDIDATE_CNT) {
+        candidate.symbol_ = symbol;
+        candidate.len_ = static_cast<uint8_t>(len);
+        candidate.gain_ = static_cast<uint32_t>(len);
+        ++candidate_cnt;
+      }
+      done = true;
+    } else if (candidate.symbol_ == symbol && candidate.len_ == len) {
+      candidate.gain_ += static_cast<uint32_t>(len);
+      done = true;
+    } else {
+      idx = (idx + 1) & (CANDIDATE_BUCKET_CNT - 1);
+    }
+  }
+}
+
+int ObFSSTSymbolTable::train_round_(const ObString *samples, const int64_t sample_cnt,
+                                    Candidate *candidates, Candidate *sorted)
+{
+  int ret = OB_SUCCESS;
+  int64_t candidate_cnt = 0;
+  MEMSET(candidates, 0, sizeof(Candidate) * CANDIDATE_BUCKET_CNT);
+  // compress samples with current table, the gain of a candidate is the bytes it covers
+  for (int64_t i = 0; i < sample_cnt; ++i) {
+    const char *str = samples[i].ptr();
+    const int64_t len = samples[i].length();
+    uint64_t prev_symbol = 0;
+    int64_t prev_len = 0;
+    int64_t pos = 0;
+    while (pos < len) {
+      uint8_t code = 0;
+      uint64_t cur_symbol = 0;
+      int64_t cur_len = find_longest_match_(str + pos, len - pos, code);
+      if (0 == cur_len) {
+        cur_len = 1;
+        cur_symbol = static_cast<uint8_t>(str[pos]);
+      } else {
+        cur_symbol = symbols_[code];
+        if (cur_len > 1) {
+          add_candidate_(candidates, candidate_cnt, static_cast<uint8_t>(str[pos]), 1);
+        }
+      }
+      add_candidate_(candidates, candidate_cnt, cur_symbol, cur_len);
+      if (prev_len > 0 && prev_len + cur_len <= MAX_SYMBOL_LEN) {
+        add_candidate_(candidates, candidate_cnt,
+            prev_symbol | (cur_symbol << (prev_len * CHAR_BIT)), prev_len + cur_len);
+      }
+      prev_symbol = cur_symbol;
+      prev_len = cur_len;
+      pos += cur_len;
+    }
+  }
+
+  int64_t sorted_cnt = 0;
+  for (int64_t i = 0; i < CANDIDATE_BUCKET_CNT; ++i) {
+    if (candidates[i].len_ > 0) {
+      sorted[sorted_cnt++] = candidates[i];
+    }
+  }
+  std::sort(sorted, sorted + sorted_cnt, [](const Candidate &l, const Candidate &r) {
+    return l.gain_ != r.gain_ ? l.gain_ > r.gain_
+        : (l.len_ != r.len_ ? l.len_ > r.len_ : l.symbol_ < r.symbol_);
+  });
+  reset();
+  symbol_cnt_ = MIN(sorted_cnt, MAX_SYMBOL_CNT);
+  for (int64_t i = 0; i < symbol_cnt_; ++i) {
+    symbols_[i] = sorted[i].symbol_;
+    lens_[i] = sorted[i].len_;
+  }
+  build_index_();
+  return ret;
+}
+
+void ObFSSTSymbolTable::build_index_()
+{
+  uint16_t next_pos[UINT8_MAX + 1];
+  MEMSET(index_, 0, sizeof(index_));
+  for (int64_t i = 0; i < symbol_cnt_; ++i) {
+    ++index_[(symbols_[i] & UINT8_MAX) + 1];
+  }
+  for (int64_t b = 0; b <= UINT8_MAX; ++b) {
+    index_[b + 1] += index_[b];
+    next_pos[b] = index_[b];
+  }
+  for (int64_t i = 0; i < symbol_cnt_; ++i) {
+    sorted_codes_[next_pos[symbols_[i] & UINT8_MAX]++] = static_cast<uint8_t>(i);
+  }
+  // longer symbols are matched first
+  for (int64_t b = 0; b <= UINT8_MAX; ++b) {
+    for (int64_t i = index_[b] + 1; i < index_[b + 1]; ++i) {
+      const uint8_t code = sorted_codes_[i];
+      int64_t j = i - 1;
+      for (; j >= index_[b] && lens_[sorted_codes_[j]] < lens_[code]; --j) {
+        sorted_codes_[j + 1] = sorted_codes_[j];
+      }
+      sorted_codes_[j + 1] = code;
+    }
+  }
+}
+
+int64_t ObFSSTSymbolTable::get_compressed_len(const char *str, const int64_t len) const
+{
+  int64_t code_len = 0;
+  int64_t pos = 0;
+  uint8_t code = 0;
+  while (pos < len) {
+    const int64_t match_len = find_longest_match_(str + pos, len - pos, code);
+    if (0 == match_len) {
+      code_len += 2;
+      pos += 1;
+    } else {
+      code_len += 1;
+      pos += match_len;
+    }
+  }
+  return code_len;
+}
+
+int ObFSSTSymbolTable::compress(
+    const char *str, const int64_t len, char *buf, const int64_t buf_len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  int64_t str_pos = 0;
+  uint8_t code = 0;
+  while (OB_SUCC(ret) && str_pos < len) {
+    const int64_t match_len = find_longest_match_(str + str_pos, len - str_pos, code);
+    if (0 == match_len) {
+      if (OB_UNLIKELY(pos + 2 > buf_len)) {
+        ret = OB_BUF_NOT_ENOUGH;
+        LOG_WARN("buf not enough", K(ret), K(pos), K(buf_len));
+      } else {
+        buf[pos++] = static_cast<char>(ESCAPE_CODE);
+        buf[pos++] = str[str_pos++];
+      }
+    } else if (OB_UNLIKELY(pos + 1 > buf_len)) {
+      ret = OB_BUF_NOT_ENOUGH;
+      LOG_WARN("buf not enough", K(ret), K(pos), K(buf_len));
+    } else {
+      buf[pos++] = static_cast<char>(code);
+      str_pos += match_len;
+    }
+  }
+  return ret;
+}
+
+int64_t ObFSSTSymbolTable::get_serialize_size() const
+{
+  int64_t size = sizeof(uint8_t) + symbol_cnt_;
+  for (int64_t i = 0; i < symbol_cnt_; ++i) {
+    size += lens_[i];
+  }
+  return size;
+}
+
+// format: symbol_cnt(1 byte) + symbol lens(symbol_cnt bytes) + symbol bytes
+int ObFSSTSymbolTable::serialize(char *buf, const int64_t buf_len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t size = get_serialize_size();
+  if (OB_ISNULL(buf) || OB_UNLIKELY(pos + size > buf_len)) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("buf not enough", K(ret), KP(buf), K(pos), K(size), K(buf_len));
+  } else {
+    buf[pos++] = static_cast<char>(symbol_cnt_);
+    MEMCPY(buf + pos, lens_, symbol_cnt_);
+    pos += symbol_cnt_;
+    for (int64_t i = 0; i < symbol_cnt_; ++i) {
+      MEMCPY(buf + pos, &symbols_[i], lens_[i]);
+      pos += lens_[i];
+    }
+  }
+  return ret;
+}
+
+int ObFSSTSymbolTable::deserialize(const char *buf, const int64_t data_len, int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_ISNULL(buf) || OB_UNLIKELY(pos >= data_len)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(pos), K(data_len));
+  } else {
+    symbol_cnt_ = static_cast<uint8_t>(buf[pos++]);
+    if (OB_UNLIKELY(symbol_cnt_ > MAX_SYMBOL_CNT || pos + symbol_cnt_ > data_len)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid fsst symbol count", K(ret), K_(symbol_cnt), K(pos), K(data_len));
+    } else {
+      MEMCPY(lens_, buf + pos, symbol_cnt_);
+      pos += symbol_cnt_;
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < symbol_cnt_; ++i) {
+      if (OB_UNLIKELY(0 == lens_[i] || lens_[i] > MAX_SYMBOL_LEN || pos + lens_[i] > data_len)) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("invalid fsst symbol", K(ret), K(i), K(lens_[i]), K(pos), K(data_len));
+      } else {
+        MEMCPY(&symbols_[i], buf + pos, lens_[i]);
+        pos += lens_[i];
+      }
+    }
+    if (OB_SUCC(ret)) {
+      build_index_();
+    }
+  }
+  return ret;
+}
+
+//============================ ObFSSTStringDecoder ==============================//
+
+ObFSSTStringDecoder::ObFSSTStringDecoder()
+  : table_(), code_data_(nullptr), code_offset_data_(nullptr), code_offset_ctx_(nullptr),
+    width_size_(0), decoded_data_(nullptr), decoded_offsets_(nullptr), decoded_offset_ctx_(),
+    single_decoded_size_(0)
+{
+}
+
+int ObFSSTStringDecoder::init(const char *str_data,
+                              const ObStringStreamMeta &meta,
+                              const char *code_offset_data,
+                              const ObIntegerStreamDecoderCtx &code_offset_ctx)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  const int64_t code_len = meta.uncompressed_len_ - meta.fsst_table_len_;
+  if (OB_ISNULL(str_data) || OB_ISNULL(code_offset_data) || OB_UNLIKELY(!meta.is_fsst_compressed())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(str_data), KP(code_offset_data), K(meta));
+  } else if (OB_FAIL(table_.deserialize(str_data + code_len, meta.fsst_table_len_, pos))) {
+    LOG_WARN("fail to deserialize fsst symbol table", K(ret), K(meta));
+  } else {
+    code_data_ = str_data;
+    code_offset_data_ = code_offset_data;
+    code_offset_ctx_ = &code_offset_ctx;
+    width_size_ = code_offset_ctx.meta_.get_uint_width_size();
+  }
+  return ret;
+}
+
+int ObFSSTStringDecoder::decode(const int64_t row_id, ObIAllocator &allocator, ObString &str)
+{
+  int ret = OB_SUCCESS;
+  uint64_t start = 0;
+  uint64_t end = 0;
+  get_code_range(row_id, start, end);
+  const int64_t len = table_.get_decoded_len(code_data_ + start, end - start);
+  // symbols are copied by 8 bytes, the buffer needs MAX_SYMBOL_LEN more bytes
+  const int64_t need_size = len + ObFSSTSymbolTable::MAX_SYMBOL_LEN;
+  char *buf = nullptr;
+  if (0 == len) {
+    str.reset();
+  } else if (is_materialized()) {
+    // read from the decoded stream below
+  } else if (single_decoded_size_ + need_size > get_code_len_()) {
+    // strings decoded one by one have taken more memory than the codes of the whole stream,
+    // decode the whole stream once so that the memory of a block is bounded
+    if (OB_FAIL(materialize(allocator))) {
+      LOG_WARN("fail to materialize", K(ret), K(row_id), K_(single_decoded_size));
+    }
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(need_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc decode buf", K(ret), K(len));
+  } else {
+    table_.decode(code_data_ + start, end - start, buf);
+    single_decoded_size_ += need_size;
+    str.assign_ptr(buf, static_cast<int32_t>(len));
+  }
+  if (OB_SUCC(ret) && len > 0 && nullptr == buf) {
+    const uint32_t offset = 0 == row_id ? 0 : decoded_offsets_[row_id - 1];
+    str.assign_ptr(decoded_data_ + offset, static_cast<int32_t>(len));
+  }
+  return ret;
+}
+
+int ObFSSTStringDecoder::materialize(ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = get_row_count();
+  char *buf = nullptr;
+  if (is_materialized()) {
+    // already decoded
+  } else if (OB_ISNULL(decoded_offsets_ = static_cast<uint32_t *>(allocator.alloc(sizeof(uint32_t) * row_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc decoded offsets", K(ret), K(row_cnt));
+  } else {
+    uint64_t start = 0;
+    uint64_t end = 0;
+    uint64_t total_len = 0;
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      get_code_range(i, start, end);
+      total_len += table_.get_decoded_len(code_data_ + start, end - start);
+      decoded_offsets_[i] = static_cast<uint32_t>(total_len);
+    }
+    if (OB_UNLIKELY(total_len > UINT32_MAX)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("decoded string is too long", K(ret), K(total_len), K(row_cnt));
+    } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(total_len + ObFSSTSymbolTable::MAX_SYMBOL_LEN)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc decoded data", K(ret), K(total_len));
+    } else {
+      int64_t pos = 0;
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        get_code_range(i, start, end);
+        pos += table_.decode(code_data_ + start, end - start, buf + pos);
+      }
+      decoded_offset_ctx_.meta_.set_raw_encoding();
+      decoded_offset_ctx_.meta_.set_4_byte_width();
+      decoded_offset_ctx_.count_ = static_cast<uint32_t>(row_cnt);
+      decoded_offset_ctx_.compressor_type_ = code_offset_ctx_->compressor_type_;
+      decoded_data_ = buf;
+    }
+  }
+  return ret;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FSST_CODEC_H_
+#define OCEANBASE_ENCODING_OB_FSST_CODEC_H_
+
+#include "ob_stream_encoding_struct.h"
+#include "ob_column_datum_iter.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// FSST(Fast Static Symbol Table) string compression.
+// Each string is compressed independently to a sequence of 1-byte codes, code c < 255 stands
+// for a symbol of 1~8 bytes and code 255 escapes the next literal byte, so any single value can
+// be decoded by its offsets without touching the others. The compression is greedy longest
+// match and deterministic, equal strings always have equal codes under the same table.
+class ObFSSTSymbolTable
+{
+public:
+  static const int64_t MAX_SYMBOL_CNT = 255;
+  static const int64_t MAX_SYMBOL_LEN = 8;
+  static const uint8_t ESCAPE_CODE = 255;
+  static const int64_t MAX_SAMPLE_SIZE = 16 * 1024;
+  static const int64_t TRAIN_ROUND = 5;
+
+  ObFSSTSymbolTable() { reset(); }
+  ~ObFSSTSymbolTable() {}
+  void reset();
+
+  // train the symbol table with the leading MAX_SAMPLE_SIZE bytes of not null datums
+  int build(ObIDatumIter &iter, common::ObIAllocator &allocator);
+  int64_t get_compressed_len(const char *str, const int64_t len) const;
+  int compress(const char *str, const int64_t len, char *buf, const int64_t buf_len, int64_t &pos) const;
+
+  OB_INLINE int64_t get_decoded_len(const char *codes, const int64_t code_len) const
+  {
+    int64_t len = 0;
+    for (int64_t i = 0; i < code_len; ++i) {
+      const uint8_t code = static_cast<uint8_t>(codes[i]);
+      if (ESCAPE_CODE == code) {
+        ++i;
+        ++len;
+      } else {
+        len += lens_[code];
+      }
+    }
+    return len;
+  }
+  // @buf must have MAX_SYMBOL_LEN bytes of slack after the decoded string
+  OB_INLINE int64_t decode(const char *codes, const int64_t code_len, char *buf) const
+  {
+    int64_t pos = 0;
+    for (int64_t i = 0; i < code_len; ++i) {
+      const uint8_t code = static_cast<uint8_t>(codes[i]);
+      if (ESCAPE_CODE == code) {
+        buf[pos++] = codes[++i];
+      } else {
+        MEMCPY(buf + pos, &symbols_[code], MAX_SYMBOL_LEN);
+        pos += lens_[code];
+      }
+    }
+    return pos;
+  }
+
+  OB_INLINE int64_t get_symbol_cnt() const { return symbol_cnt_; }
+  int64_t get_serialize_size() const;
+  int serialize(char *buf, const int64_t buf_len, int64_t &pos) const;
+  int deserialize(const char *buf, const int64_t data_len, int64_t &pos);
+
+  TO_STRING_KV(K_(symbol_cnt));
+
+private:
+  struct Candidate
+  {
+    uint64_t symbol_;
+    uint32_t gain_;
+    uint8_t len_;
+  };
+  static const int64_t CANDIDATE_BUCKET_CNT = 4096;
+
+  // return the length of longest symbol which is a prefix of str, 0 if not found
+  OB_INLINE int64_t find_longest_match_(const char *str, const int64_t len, uint8_t &code) const
+  {
+    int64_t match_len = 0;
+    const uint8_t first_byte = static_cast<uint8_t>(str[0]);
+    uint64_t prefix = 0;
+    MEMCPY(&prefix, str, MIN(len, MAX_SYMBOL_LEN));
+    for (int64_t i = index_[first_byte]; 0 == match_len && i < index_[first_byte + 1]; ++i) {
+      const uint8_t cur_code = sorted_codes_[i];
+      const int64_t cur_len = lens_[cur_code];
+      if (cur_len <= len && (prefix & get_mask_(cur_len)) == symbols_[cur_code]) {
+        match_len = cur_len;
+        code = cur_code;
+      }
+    }
+    return match_len;
+  }
+  static OB_INLINE uint64_t get_mask_(const int64_t len)
+  {
+    return MAX_SYMBOL_LEN == len ? UINT64_MAX : ((1ULL << (len * CHAR_BIT)) - 1);
+  }
+  static void add_candidate_(Candidate *candidates, int64_t &candidate_cnt,
+                             const uint64_t symbol, const int64_t len);
+  int train_round_(const common::ObString *samples, const int64_t sample_cnt,
+                   Candidate *candidates, Candidate *sorted);
+  void build_index_();
+
+private:
+  uint64_t symbols_[MAX_SYMBOL_CNT + 1]; // little endian, the unused high bytes are zero
+  uint8_t lens_[MAX_SYMBOL_CNT + 1];
+  int64_t symbol_cnt_;
+  // codes sorted by first byte and then by length desc,
+  // codes which start with byte b are in sorted_codes_[index_[b], index_[b + 1])
+  uint16_t index_[UINT8_MAX + 2];
+  uint8_t sorted_codes_[MAX_SYMBOL_CNT];
+};
+
+// Decoder of a FSST compressed string stream. The stream stores the codes of all strings
+// and the serialized symbol table at the tail, the offsets are the end offsets of codes.
+// The stream can be decoded to a plain string stream which has uint32_t end offsets.
+class ObFSSTStringDecoder
+{
+public:
+  ObFSSTStringDecoder();
+  ~ObFSSTStringDecoder() {}
+
+  int init(const char *str_data,
+           const ObStringStreamMeta &meta,
+           const char *code_offset_data,
+           const ObIntegerStreamDecoderCtx &code_offset_ctx);
+  // decode one string to memory allocated by @allocator, @str is valid as long as @allocator.
+  // Once the strings decoded one by one take more memory than the codes, the whole stream is
+  // materialized and @str points to the decoded stream.
+  int decode(const int64_t row_id, common::ObIAllocator &allocator, common::ObString &str);
+  // decode all strings to a plain string stream, only do once
+  int materialize(common::ObIAllocator &allocator);
+
+  OB_INLINE bool is_materialized() const { return nullptr != decoded_data_; }
+  OB_INLINE const ObFSSTSymbolTable &get_symbol_table() const { return table_; }
+  OB_INLINE const char *get_code_data() const { return code_data_; }
+  OB_INLINE int64_t get_row_count() const { return code_offset_ctx_->count_; }
+  OB_INLINE void get_code_range(const int64_t row_id, uint64_t &start, uint64_t &end) const
+  {
+    start = 0 == row_id ? 0 : get_code_offset_(row_id - 1);
+    end = get_code_offset_(row_id);
+  }
+  OB_INLINE const char *get_decoded_data() const { return decoded_data_; }
+  OB_INLINE const char *get_decoded_offset_data() const
+  {
+    return reinterpret_cast<const char *>(decoded_offsets_);
+  }
+  OB_INLINE const ObIntegerStreamDecoderCtx &get_decoded_offset_ctx() const { return decoded_offset_ctx_; }
+
+  TO_STRING_KV(K_(table), KP_(code_data), KP_(code_offset_data), KPC_(code_offset_ctx),
+      K_(width_size), KP_(decoded_data), KP_(decoded_offsets), K_(decoded_offset_ctx),
+      K_(single_decoded_size));
+
+private:
+  OB_INLINE uint64_t get_code_offset_(const int64_t idx) const
+  {
+    uint64_t offset = 0;
+    MEMCPY(&offset, code_offset_data_ + idx * width_size_, width_size_);
+    return offset;
+  }
+  OB_INLINE int64_t get_code_len_() const
+  {
+    return 0 == get_row_count() ? 0 : get_code_offset_(get_row_count() - 1);
+  }
+
+private:
+  ObFSSTSymbolTable table_;
+  const char *code_data_;
+  const char *code_offset_data_;
+  const ObIntegerStreamDecoderCtx *code_offset_ctx_;
+  uint32_t width_size_;
+  const char *decoded_data_;
+  uint32_t *decoded_offsets_;
+  ObIntegerStreamDecoderCtx decoded_offset_ctx_;
+  int64_t single_decoded_size_;
+};
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
+
+#endif  // OCEANBASE_ENCODING_OB_FSST_CODEC_H_
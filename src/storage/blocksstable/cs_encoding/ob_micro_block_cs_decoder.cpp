@@ -17,6 +17,7 @@
 #include "lib/container/ob_array_iterator.h"
 #include "ob_dict_column_decoder.h"
 #include "ob_integer_column_decoder.h"
+#include "ob_float_column_decoder.h"
 #include "ob_string_column_decoder.h"
 #include "share/rc/ob_tenant_base.h"
 #include "storage/access/ob_pushdown_aggregate.h"
@@ -232,6 +233,7 @@ static local_decode_acquire_func acquire_local_funcs_[ObCSColumnHeader::MAX_TYPE
     acquire_local_decoder<ObStringColumnDecoder>,
     acquire_local_decoder<ObIntDictColumnDecoder>,
     acquire_local_decoder<ObStrDictColumnDecoder>,
+    acquire_local_decoder<ObFloatColumnDecoder>,
 };
 
 static local_decode_release_func release_local_funcs_[ObCSColumnHeader::MAX_TYPE] = {
@@ -239,6 +241,7 @@ static local_decode_release_func release_local_funcs_[ObCSColumnHeader::MAX_TYPE
     release_local_decoder<ObStringColumnDecoder>,
     release_local_decoder<ObIntDictColumnDecoder>,
     release_local_decoder<ObStrDictColumnDecoder>,
+    release_local_decoder<ObFloatColumnDecoder>,
 };
 
 template <class Decoder>
@@ -789,6 +792,15 @@ int ObMicroBlockCSDecoder::acquire(
     }
     break;
   }
+  case ObCSColumnHeader::FLOAT: {
+    ObFloatColumnDecoder *d = NULL;
+    if (OB_FAIL(allocator.alloc(d))) {
+      LOG_WARN("alloc failed", K(ret));
+    } else {
+      decoder = d;
+    }
+    break;
+  }
   default:
     ret = OB_INNER_STAT_ERROR;
     LOG_WARN("unsupported encoding type", K(ret), K(type));
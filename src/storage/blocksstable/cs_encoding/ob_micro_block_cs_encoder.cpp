@@ -17,6 +17,7 @@
 #include "ob_cs_encoding_util.h"
 #include "ob_icolumn_cs_encoder.h"
 #include "ob_integer_column_encoder.h"
+#include "ob_float_column_encoder.h"
 #include "ob_integer_stream_encoder.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_force_print_log.h"
@@ -1087,6 +1088,15 @@ int ObMicroBlockCSEncoder::choose_specified_encoder_(const int64_t column_idx,
       if (OB_FAIL(alloc_and_init_encoder_<ObIntDictColumnEncoder>(column_idx, e))) {
         LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
       }
+    } else if (ObCSColumnHeader::Type::FLOAT == type && is_float_type_class_(column_idx)) {
+      if (!can_use_float_encoder_(column_idx)) {
+        // servers of lower data version can't read FLOAT encoding, fall back to INTEGER
+        if (OB_FAIL(alloc_and_init_encoder_<ObIntegerColumnEncoder>(column_idx, e))) {
+          LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
+        }
+      } else if (OB_FAIL(alloc_and_init_encoder_<ObFloatColumnEncoder>(column_idx, e))) {
+        LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
+      }
     } else {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("specified unexpected econding type", K(ret), K(column_idx), K(store_class), K(col_ctx));
@@ -1152,20 +1162,43 @@ int ObMicroBlockCSEncoder::choose_encoder_(const int64_t column_idx)
   return ret;
 }
 
+bool ObMicroBlockCSEncoder::is_float_type_class_(const int64_t column_idx) const
+{
+  const ObObjTypeClass tc = ctx_.col_descs_->at(column_idx).col_type_.get_type_class();
+  return ObFloatTC == tc || ObDoubleTC == tc;
+}
+
+bool ObMicroBlockCSEncoder::can_use_float_encoder_(const int64_t column_idx) const
+{
+  return is_float_type_class_(column_idx)
+      && ctx_.major_working_cluster_version_ >= ObCSEncodingUtil::FLOAT_MIN_DATA_VERSION;
+}
+
 int ObMicroBlockCSEncoder::choose_encoder_for_integer_(
   const int64_t column_idx, ObIColumnCSEncoder *&e)
 {
   int ret = OB_SUCCESS;
   ObIColumnCSEncoder *integer_encoder = nullptr;
   ObIColumnCSEncoder *dict_encoder = nullptr;
+  ObIColumnCSEncoder *float_encoder = nullptr;
   if (OB_FAIL(alloc_and_init_encoder_<ObIntegerColumnEncoder>(column_idx, integer_encoder))) {
     LOG_WARN("fail to alloc encoder", K(ret), K(column_idx));
   } else if (OB_FAIL(alloc_and_init_encoder_<ObIntDictColumnEncoder>(column_idx, dict_encoder))) {
     LOG_WARN("fail to alloc encoder", K(ret), K(column_idx));
+  } else if (can_use_float_encoder_(column_idx)
+      && OB_FAIL(alloc_and_init_encoder_<ObFloatColumnEncoder>(column_idx, float_encoder))) {
+    LOG_WARN("fail to alloc encoder", K(ret), K(column_idx));
   } else {
     int64_t integer_estimate_size = integer_encoder->estimate_store_size();
     int64_t dict_estimate_size = dict_encoder->estimate_store_size();
-    if (dict_estimate_size < integer_estimate_size) {
+    int64_t float_estimate_size = nullptr == float_encoder ? INT64_MAX : float_encoder->estimate_store_size();
+    if (float_estimate_size < integer_estimate_size && float_estimate_size <= dict_estimate_size) {
+      e = float_encoder;
+      free_encoder_(integer_encoder);
+      integer_encoder = nullptr;
+      free_encoder_(dict_encoder);
+      dict_encoder = nullptr;
+    } else if (dict_estimate_size < integer_estimate_size) {
       e = dict_encoder;
       free_encoder_(integer_encoder);
       integer_encoder = nullptr;
@@ -1174,8 +1207,12 @@ int ObMicroBlockCSEncoder::choose_encoder_for_integer_(
       free_encoder_(dict_encoder);
       dict_encoder = nullptr;
     }
-    LOG_DEBUG("choose encoder for integer", K(ret), K(column_idx),
-       K(integer_estimate_size), K(dict_estimate_size), KPC(integer_encoder), KPC(dict_encoder));
+    if (nullptr != float_encoder && e != float_encoder) {
+      free_encoder_(float_encoder);
+      float_encoder = nullptr;
+    }
+    LOG_DEBUG("choose encoder for integer", K(ret), K(column_idx), K(integer_estimate_size),
+       K(dict_estimate_size), K(float_estimate_size), KPC(integer_encoder), KPC(dict_encoder));
   }
 
   if (OB_FAIL(ret)) {
@@ -1187,6 +1224,10 @@ int ObMicroBlockCSEncoder::choose_encoder_for_integer_(
       free_encoder_(dict_encoder);
       dict_encoder = nullptr;
     }
+    if (nullptr != float_encoder) {
+      free_encoder_(float_encoder);
+      float_encoder = nullptr;
+    }
   }
 
 
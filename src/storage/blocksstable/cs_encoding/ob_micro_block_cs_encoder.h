@@ -83,6 +83,8 @@ private:
   int64_t calc_datum_row_size_(const ObDatumRow &src) const;
   int prescan_(const int64_t column_index);
   int choose_encoder_(const int64_t column_idx);
+  bool is_float_type_class_(const int64_t column_idx) const;
+  bool can_use_float_encoder_(const int64_t column_idx) const;
   int choose_encoder_for_integer_(const int64_t column_idx, ObIColumnCSEncoder *&e);
   int choose_encoder_for_string_(const int64_t column_idx, ObIColumnCSEncoder *&e);
   int choose_specified_encoder_(const int64_t column_idx,
@@ -55,6 +55,7 @@ void ObStrDictColumnEncoder::reuse()
 {
   ObDictColumnEncoder::reuse();
   string_dict_enc_ctx_.reset();
+  fsst_table_.reset();
 }
 
 int ObStrDictColumnEncoder::build_string_dict_encoder_ctx_()
@@ -83,12 +84,31 @@ int ObStrDictColumnEncoder::build_string_dict_encoder_ctx_()
         ctx_->encoding_ctx_->previous_cs_encoding_.get_column_encoding(column_index_),
         int_stream_idx, ctx_->allocator_))) {
       LOG_WARN("fail to build_string_stream_encoder_info", K(ret), KPC_(ctx));
+    } else if (ctx_->fix_data_size_ < 0 && !is_force_raw_ && ObStringSC == store_class_
+        && ctx_->encoding_ctx_->major_working_cluster_version_ >= ObCSEncodingUtil::FSST_MIN_DATA_VERSION
+        && OB_FAIL(try_use_fsst_())) {
+      LOG_WARN("fail to try use fsst", K(ret));
     }
   }
 
   return ret;
 }
 
+int ObStrDictColumnEncoder::try_use_fsst_()
+{
+  int ret = OB_SUCCESS;
+  ObDictDatumIter iter(*ctx_->ht_);
+  uint32_t code_len = 0;
+  bool is_fsst_used = false;
+  if (OB_FAIL(ObCSEncodingUtil::try_build_fsst_table(
+      iter, ctx_->dict_var_data_size_, *ctx_->allocator_, fsst_table_, code_len, is_fsst_used))) {
+    LOG_WARN("fail to try build fsst table", K(ret), KPC_(ctx));
+  } else if (is_fsst_used && OB_FAIL(string_dict_enc_ctx_.build_fsst_stream_meta(fsst_table_, code_len))) {
+    LOG_WARN("fail to build fsst stream meta", K(ret), K(code_len));
+  }
+  return ret;
+}
+
 int ObStrDictColumnEncoder::store_column(ObMicroBufferWriter &buf_writer)
 {
   int ret = OB_SUCCESS;
@@ -169,9 +189,10 @@ int64_t ObStrDictColumnEncoder::estimate_store_size() const
       if (string_dict_enc_ctx_.meta_.is_fixed_len_string()) {
         size += string_dict_enc_ctx_.meta_.get_fixed_string_len() * distinct;
       } else {
-        // dict_data_size +  dict_string_offset_array_size
-        size += ctx_->dict_var_data_size_;
-        uint64_t avg_string_length = ctx_->dict_var_data_size_ / distinct;
+        // dict_data_size +  dict_string_offset_array_size, dict data is fsst codes and symbol table if fsst is used
+        const int64_t dict_data_size = string_dict_enc_ctx_.meta_.uncompressed_len_;
+        size += dict_data_size;
+        uint64_t avg_string_length = dict_data_size / distinct;
         size += ObCSEncodingUtil::get_bit_size(avg_string_length) * distinct / CHAR_BIT ;
       }
 
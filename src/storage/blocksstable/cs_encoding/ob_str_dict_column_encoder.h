@@ -14,6 +14,7 @@
 #define OCEANBASE_ENCODING_OB_STR_DICT_COLUMN_ENCODER_H_
 
 #include "ob_dict_column_encoder.h"
+#include "ob_fsst_codec.h"
 
 namespace oceanbase
 {
@@ -25,7 +26,8 @@ public:
   static const ObCSColumnHeader::Type type_ = ObCSColumnHeader::STR_DICT;
   ObStrDictColumnEncoder()
     : ObDictColumnEncoder(),
-      string_dict_enc_ctx_() { }
+      string_dict_enc_ctx_(),
+      fsst_table_() { }
   virtual ~ObStrDictColumnEncoder() {}
 
   int init(
@@ -41,11 +43,13 @@ public:
 
 private:
   int build_string_dict_encoder_ctx_();
+  int try_use_fsst_();
   int sort_dict_();
   int store_dict_(ObMicroBufferWriter &buf_writer);
 
 private:
   ObStringStreamEncoderCtx string_dict_enc_ctx_;
+  ObFSSTSymbolTable fsst_table_;
 };
 
 }  // end namespace blocksstable
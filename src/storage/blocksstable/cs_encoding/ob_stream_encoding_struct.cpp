@@ -15,6 +15,7 @@
 
 #include "ob_stream_encoding_struct.h"
 #include "ob_column_encoding_struct.h"
+#include "ob_fsst_codec.h"
 
 
 namespace oceanbase
@@ -223,6 +224,8 @@ DEFINE_SERIALIZE(ObStringStreamMeta)
     LOG_WARN("fail to encode uncompressed_len_", K(ret));
   } else if (is_fixed_len_string() && OB_FAIL(serialization::encode_vi32(buf, buf_len, pos, fixed_str_len_))) {
     LOG_WARN("fail to encode fixed_str_len_", K(ret));
+  } else if (is_fsst_compressed() && OB_FAIL(serialization::encode_vi32(buf, buf_len, pos, fsst_table_len_))) {
+    LOG_WARN("fail to encode fsst_table_len_", K(ret));
   }
   return ret;
 }
@@ -232,12 +235,20 @@ DEFINE_DESERIALIZE(ObStringStreamMeta)
   int ret = OB_SUCCESS;
   if (OB_FAIL(serialization::decode_i8(buf, data_len, pos, (int8_t*)&version_))) {
     LOG_WARN("fail to decode version", K(ret));
+  } else if (OB_UNLIKELY(version_ > OB_STRING_STREAM_META_V2)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("not supported string stream meta version", K(ret), K_(version));
   } else if (OB_FAIL(serialization::decode_i8(buf, data_len, pos, (int8_t*)&attr_))) {
     LOG_WARN("fail to decode attr", K(ret));
+  } else if (OB_UNLIKELY(is_fsst_compressed() && version_ < OB_STRING_STREAM_META_V2)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("fsst compressed string stream meta must be V2", K(ret), K_(version), K_(attr));
   } else if (OB_FAIL(serialization::decode_vi32(buf, data_len, pos, (int32_t*)&uncompressed_len_))) {
     LOG_WARN("fail to decode uncompressed_len_", K(ret));
   } else if (is_fixed_len_string() && OB_FAIL(serialization::decode_vi32(buf, data_len, pos, (int32_t*)&fixed_str_len_))) {
     LOG_WARN("fail to decode fixed_str_len_", K(ret));
+  } else if (is_fsst_compressed() && OB_FAIL(serialization::decode_vi32(buf, data_len, pos, (int32_t*)&fsst_table_len_))) {
+    LOG_WARN("fail to decode fsst_table_len_", K(ret));
   }
   return ret;
 }
@@ -251,6 +262,9 @@ DEFINE_GET_SERIALIZE_SIZE(ObStringStreamMeta)
   if (is_fixed_len_string()) {
     len += serialization::encoded_length_vi32(fixed_str_len_);
   }
+  if (is_fsst_compressed()) {
+    len += serialization::encoded_length_vi32(fsst_table_len_);
+  }
   return len;
 }
 
@@ -270,6 +284,21 @@ int ObStringStreamEncoderCtx::build_string_stream_meta(const int64_t fixed_len,
   return ret;
 }
 
+int ObStringStreamEncoderCtx::build_fsst_stream_meta(const ObFSSTSymbolTable &table, const uint32_t code_len)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(meta_.is_fixed_len_string())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("fixed length string can not be fsst compressed", K(ret), K_(meta));
+  } else {
+    meta_.set_is_fsst_compressed();
+    meta_.fsst_table_len_ = static_cast<uint32_t>(table.get_serialize_size());
+    meta_.uncompressed_len_ = code_len + meta_.fsst_table_len_;
+    info_.fsst_table_ = &table;
+  }
+  return ret;
+}
+
 int ObStringStreamEncoderCtx::build_string_stream_encoder_info(
         const common::ObCompressorType compressor_type,
         const bool raw_encoding_str_offset,
@@ -46,6 +46,7 @@ struct ObStreamData
 
 class ObCSEncodingOpt;
 class ObPreviousColumnEncoding;
+class ObFSSTSymbolTable;
 
 // ========================== encoding struct for integer stream ==========================//
 
@@ -326,11 +327,13 @@ struct ObIntegerStreamEncoderCtx
 struct ObStringStreamMeta
 {
   static constexpr uint8_t OB_STRING_STREAM_META_V1 = 0;
+  static constexpr uint8_t OB_STRING_STREAM_META_V2 = 1; // support IS_FSST_COMPRESSED and fsst_table_len_
   enum Attribute : uint8_t
   {
     USE_NONE = 0x0,
     USE_ZERO_LEN_AS_NULL = 0x1,
     IS_FIXED_LEN_STRING = 0x02,
+    IS_FSST_COMPRESSED = 0x04,
   };
 
   ObStringStreamMeta() { reset(); }
@@ -355,8 +358,20 @@ struct ObStringStreamMeta
   {
     attr_ = (attr_ | Attribute::IS_FIXED_LEN_STRING);
   }
+  // the string data is FSST codes followed by the symbol table,
+  // uncompressed_len_ is the total length and offsets are the end offsets of codes.
+  OB_INLINE bool is_fsst_compressed() const
+  {
+    return (attr_ & Attribute::IS_FSST_COMPRESSED) > 0;
+  }
+  OB_INLINE void set_is_fsst_compressed()
+  {
+    version_ = OB_STRING_STREAM_META_V2;
+    attr_ = (attr_ | Attribute::IS_FSST_COMPRESSED);
+  }
+  OB_INLINE uint32_t get_string_data_len() const { return uncompressed_len_ - fsst_table_len_; }
 
-  TO_STRING_KV(K_(version), K_(attr), K_(uncompressed_len), K_(fixed_str_len));
+  TO_STRING_KV(K_(version), K_(attr), K_(uncompressed_len), K_(fixed_str_len), K_(fsst_table_len));
 
   NEED_SERIALIZE_AND_DESERIALIZE;
 
@@ -364,6 +379,7 @@ struct ObStringStreamMeta
   uint8_t attr_;
   uint32_t uncompressed_len_;
   uint32_t fixed_str_len_;
+  uint32_t fsst_table_len_;
 };
 
 struct ObStringStreamEncoderInfo
@@ -377,11 +393,12 @@ struct ObStringStreamEncoderInfo
     previous_encoding_ = nullptr;
     int_stream_idx_ = -1;
     allocator_ = nullptr;
+    fsst_table_ = nullptr;
   }
 
   TO_STRING_KV("compressor_type", all_compressor_name[compressor_type_],
       K_(raw_encoding_str_offset), KP_(encoding_opt), KPC_(previous_encoding),
-      K_(int_stream_idx), KP_(allocator));
+      K_(int_stream_idx), KP_(allocator), KP_(fsst_table));
 
   common::ObCompressorType compressor_type_;
   bool raw_encoding_str_offset_;
@@ -389,6 +406,7 @@ struct ObStringStreamEncoderInfo
   const ObPreviousColumnEncoding *previous_encoding_;
   int32_t int_stream_idx_;
   ObIAllocator *allocator_;
+  const ObFSSTSymbolTable *fsst_table_;
 };
 
 struct ObStringStreamEncoderCtx
@@ -403,6 +421,8 @@ struct ObStringStreamEncoderCtx
   int build_string_stream_meta(const int64_t fix_len,
                                const bool use_zero_length_as_null,
                                const uint32_t uncompress_len);
+  // must be called after build_string_stream_meta, @code_len is the total FSST codes length
+  int build_fsst_stream_meta(const ObFSSTSymbolTable &table, const uint32_t code_len);
   int build_string_stream_encoder_info(
        const common::ObCompressorType compressor_type,
        const bool raw_encoding_str_offset,
@@ -17,6 +17,7 @@
 #include "ob_cs_encoding_util.h"
 #include "ob_cs_decoding_util.h"
 #include "ob_string_stream_vector_decoder.h"
+#include "ob_fsst_codec.h"
 
 namespace oceanbase
 {
@@ -27,9 +28,17 @@ int ObStringColumnDecoder::decode(
   const ObColumnCSDecoderCtx &ctx, const int64_t row_id, common::ObDatum &datum) const
 {
   int ret = OB_SUCCESS;
-  const ObStringColumnDecoderCtx &string_ctx = ctx.string_ctx_;
+  const ObStringColumnDecoderCtx &orig_ctx = ctx.string_ctx_;
+  ObStringColumnDecoderCtx string_ctx;
 
-  if (string_ctx.str_ctx_->meta_.is_fixed_len_string()) {
+  if (nullptr != orig_ctx.fsst_decoder_ && !orig_ctx.fsst_decoder_->is_materialized()) {
+    // random access to a single fsst compressed value
+    if (OB_FAIL(decode_fsst(orig_ctx, row_id, datum))) {
+      LOG_WARN("fail to decode fsst string", K(ret), K(row_id), K(orig_ctx));
+    }
+  } else if (OB_FAIL(get_plain_ctx(orig_ctx, string_ctx))) {
+    LOG_WARN("fail to get plain string ctx", K(ret), K(orig_ctx));
+  } else if (string_ctx.str_ctx_->meta_.is_fixed_len_string()) {
     ConvertStringToDatumFunc convert_func = convert_string_to_datum_funcs
         [FIX_STRING_OFFSET_WIDTH_V]
         [ObRefStoreWidthV::NOT_REF]
@@ -54,8 +63,10 @@ int ObStringColumnDecoder::batch_decode(const ObColumnCSDecoderCtx &ctx,
     const int64_t *row_ids, const int64_t row_cap, common::ObDatum *datums) const
 {
   int ret = OB_SUCCESS;
-  const ObStringColumnDecoderCtx &string_ctx = ctx.string_ctx_;
-  if (string_ctx.str_ctx_->meta_.is_fixed_len_string()) {
+  ObStringColumnDecoderCtx string_ctx;
+  if (OB_FAIL(get_plain_ctx(ctx.string_ctx_, string_ctx))) {
+    LOG_WARN("fail to get plain string ctx", K(ret), K(ctx.string_ctx_));
+  } else if (string_ctx.str_ctx_->meta_.is_fixed_len_string()) {
     ConvertStringToDatumFunc convert_func = convert_string_to_datum_funcs
         [FIX_STRING_OFFSET_WIDTH_V]
         [ObRefStoreWidthV::NOT_REF]
@@ -79,16 +90,61 @@ int ObStringColumnDecoder::decode_vector(
     const ObColumnCSDecoderCtx &ctx, ObVectorDecodeCtx &vector_ctx) const
 {
   int ret = OB_SUCCESS;
-  const ObStringColumnDecoderCtx &string_ctx = ctx.string_ctx_;
-  ObStringStreamVecDecoder::StrVecDecoderCtx vec_decoder_ctx(
-    string_ctx.str_data_, string_ctx.str_ctx_, string_ctx.offset_data_, string_ctx.offset_ctx_, string_ctx.need_copy_);
+  ObStringColumnDecoderCtx string_ctx;
+  if (OB_FAIL(get_plain_ctx(ctx.string_ctx_, string_ctx))) {
+    LOG_WARN("fail to get plain string ctx", K(ret), K(ctx.string_ctx_));
+  } else {
+    ObStringStreamVecDecoder::StrVecDecoderCtx vec_decoder_ctx(
+      string_ctx.str_data_, string_ctx.str_ctx_, string_ctx.offset_data_, string_ctx.offset_ctx_, string_ctx.need_copy_);
 
-  if (OB_FAIL(ObStringStreamVecDecoder::decode_vector(
-    string_ctx, vec_decoder_ctx, nullptr, ObVecDecodeRefWidth::VDRW_NOT_REF, vector_ctx))) {
-    LOG_WARN("fail to decode_vector", K(ret), K(vec_decoder_ctx), K(vector_ctx));
+    if (OB_FAIL(ObStringStreamVecDecoder::decode_vector(
+      string_ctx, vec_decoder_ctx, nullptr, ObVecDecodeRefWidth::VDRW_NOT_REF, vector_ctx))) {
+      LOG_WARN("fail to decode_vector", K(ret), K(vec_decoder_ctx), K(vector_ctx));
+    }
   }
   return ret;
+}
 
+int ObStringColumnDecoder::get_plain_ctx(
+    const ObStringColumnDecoderCtx &ctx, ObStringColumnDecoderCtx &plain_ctx)
+{
+  int ret = OB_SUCCESS;
+  plain_ctx = ctx;
+  if (nullptr == ctx.fsst_decoder_) {
+    // not compressed
+  } else if (OB_FAIL(ctx.fsst_decoder_->materialize(*ctx.allocator_))) {
+    LOG_WARN("fail to materialize fsst string", K(ret), KPC(ctx.fsst_decoder_));
+  } else {
+    plain_ctx.str_data_ = ctx.fsst_decoder_->get_decoded_data();
+    plain_ctx.offset_data_ = ctx.fsst_decoder_->get_decoded_offset_data();
+    plain_ctx.offset_ctx_ = &ctx.fsst_decoder_->get_decoded_offset_ctx();
+    plain_ctx.fsst_decoder_ = nullptr;
+  }
+  return ret;
+}
+
+int ObStringColumnDecoder::decode_fsst(
+    const ObStringColumnDecoderCtx &ctx, const int64_t row_id, common::ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  uint64_t start = 0;
+  uint64_t end = 0;
+  ctx.fsst_decoder_->get_code_range(row_id, start, end);
+  if ((ctx.has_null_bitmap() && ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_id))
+      || (ctx.is_null_replaced() && start == end)) {
+    datum.set_null();
+  } else {
+    ObString str;
+    if (OB_FAIL(ctx.fsst_decoder_->decode(row_id, *ctx.allocator_, str))) {
+      LOG_WARN("fail to decode fsst string", K(ret), K(row_id));
+    } else if (ctx.need_copy_) {
+      ENCODING_ADAPT_MEMCPY(const_cast<char *>(datum.ptr_), str.ptr(), str.length());
+      datum.pack_ = static_cast<uint32_t>(str.length());
+    } else {
+      datum.ptr_ = str.ptr();
+      datum.pack_ = static_cast<uint32_t>(str.length());
+    }
+  }
   return ret;
 }
 
@@ -397,14 +453,21 @@ int ObStringColumnDecoder::pushdown_operator(
     ObBitmap &result_bitmap) const
 {
   int ret = OB_SUCCESS;
-  const ObStringColumnDecoderCtx &string_ctx = col_ctx.string_ctx_;
+  const ObStringColumnDecoderCtx &orig_ctx = col_ctx.string_ctx_;
+  ObStringColumnDecoderCtx string_ctx;
   const int64_t row_cnt = pd_filter_info.count_;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
   if (OB_UNLIKELY(row_cnt < 1 || row_cnt != result_bitmap.size())) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("invalid argument", KR(ret), K(row_cnt), K(string_ctx), K(result_bitmap.size()));
+    LOG_WARN("invalid argument", KR(ret), K(row_cnt), K(orig_ctx), K(result_bitmap.size()));
+  } else if (nullptr != orig_ctx.fsst_decoder_ && can_filter_on_fsst_codes(orig_ctx, filter)) {
+    if (OB_FAIL(fsst_codes_operator(orig_ctx, row_start, row_count, filter, result_bitmap))) {
+      LOG_WARN("fail to filter on fsst codes", KR(ret), K(pd_filter_info), K(col_ctx));
+    }
+  } else if (OB_FAIL(get_plain_ctx(orig_ctx, string_ctx))) {
+    LOG_WARN("fail to get plain string ctx", KR(ret), K(orig_ctx));
   } else {
-    const int64_t row_start = pd_filter_info.start_;
-    const int64_t row_count = pd_filter_info.count_;
     const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
     switch(op_type) {
       case sql::WHITE_OP_NU:
@@ -449,8 +512,89 @@ int ObStringColumnDecoder::pushdown_operator(
         LOG_WARN("Unexpected operation type", KR(ret), K(op_type));
       }
     }
-    LOG_TRACE("string white filter pushdown", K(ret), "string_ctx", col_ctx.string_ctx_,
-        K(filter.get_op_type()), K(pd_filter_info), K(result_bitmap.popcnt()));
+  }
+  LOG_TRACE("string white filter pushdown", K(ret), "string_ctx", col_ctx.string_ctx_,
+      K(filter.get_op_type()), K(pd_filter_info), K(result_bitmap.popcnt()));
+  return ret;
+}
+
+bool ObStringColumnDecoder::can_filter_on_fsst_codes(
+    const ObStringColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter)
+{
+  bool can_filter = false;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (sql::WHITE_OP_NU == op_type || sql::WHITE_OP_NN == op_type) {
+    can_filter = true;
+  } else if (sql::WHITE_OP_EQ == op_type || sql::WHITE_OP_NE == op_type || sql::WHITE_OP_IN == op_type) {
+    // equal codes means equal bytes, only correct for binary collation without padding
+    const int64_t datum_cnt = filter.get_datums().count();
+    can_filter = common::CS_TYPE_BINARY == ctx.obj_meta_.get_collation_type()
+        && !(ctx.obj_meta_.is_fixed_len_char_type() && nullptr != ctx.col_param_)
+        && datum_cnt > 0 && datum_cnt <= MAX_FSST_FILTER_DATUM_CNT
+        && (sql::WHITE_OP_IN == op_type || 1 == datum_cnt);
+    for (int64_t i = 0; can_filter && i < datum_cnt; ++i) {
+      can_filter = !filter.get_datums().at(i).is_null();
+    }
+  }
+  return can_filter;
+}
+
+int ObStringColumnDecoder::fsst_codes_operator(
+    const ObStringColumnDecoderCtx &ctx,
+    const int64_t row_start,
+    const int64_t row_count,
+    const sql::ObWhiteFilterExecutor &filter,
+    common::ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const ObFSSTStringDecoder &fsst_decoder = *ctx.fsst_decoder_;
+  const ObFSSTSymbolTable &table = fsst_decoder.get_symbol_table();
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const bool is_null_check = sql::WHITE_OP_NU == op_type || sql::WHITE_OP_NN == op_type;
+  const int64_t datum_cnt = is_null_check ? 0 : filter.get_datums().count();
+  ObString filter_codes[MAX_FSST_FILTER_DATUM_CNT];
+  // compress the constants with the symbol table of this stream
+  for (int64_t i = 0; OB_SUCC(ret) && i < datum_cnt; ++i) {
+    const ObDatum &datum = filter.get_datums().at(i);
+    const int64_t buf_len = datum.len_ * 2;
+    char *buf = nullptr;
+    int64_t pos = 0;
+    if (0 == buf_len) {
+      filter_codes[i].reset();
+    } else if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_len)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc filter codes", KR(ret), K(buf_len));
+    } else if (OB_FAIL(table.compress(datum.ptr_, datum.len_, buf, buf_len, pos))) {
+      LOG_WARN("fail to compress filter datum", KR(ret), K(datum));
+    } else {
+      filter_codes[i].assign_ptr(buf, static_cast<int32_t>(pos));
+    }
+  }
+
+  const char *codes = fsst_decoder.get_code_data();
+  uint64_t start = 0;
+  uint64_t end = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    const int64_t row_id = row_start + i;
+    fsst_decoder.get_code_range(row_id, start, end);
+    const bool is_null = (ctx.has_null_bitmap() && ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_id))
+        || (ctx.is_null_replaced() && start == end);
+    bool is_match = false;
+    if (is_null_check) {
+      is_match = (sql::WHITE_OP_NU == op_type) == is_null;
+    } else if (!is_null) {
+      const ObString row_codes(static_cast<int32_t>(end - start), codes + start);
+      for (int64_t j = 0; !is_match && j < datum_cnt; ++j) {
+        is_match = row_codes == filter_codes[j];
+      }
+      if (sql::WHITE_OP_NE == op_type) {
+        is_match = !is_match;
+      }
+    }
+    if (is_match && OB_FAIL(result_bitmap.set(i))) {
+      LOG_WARN("fail to set", KR(ret), K(i), K(row_start));
+    }
   }
   return ret;
 }
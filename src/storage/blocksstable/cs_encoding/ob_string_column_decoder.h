@@ -72,6 +72,22 @@ private:
                          const sql::ObPushdownFilterExecutor *parent,
                          const sql::ObWhiteFilterExecutor &filter,
                          common::ObBitmap &result_bitmap);
+
+  // fsst compressed strings are decoded to a plain string stream on first use,
+  // @plain_ctx is a copy of @ctx which refers to the plain string stream.
+  static int get_plain_ctx(const ObStringColumnDecoderCtx &ctx, ObStringColumnDecoderCtx &plain_ctx);
+  static int decode_fsst(const ObStringColumnDecoderCtx &ctx, const int64_t row_id, common::ObDatum &datum);
+  static bool can_filter_on_fsst_codes(const ObStringColumnDecoderCtx &ctx,
+                                       const sql::ObWhiteFilterExecutor &filter);
+  // evaluate null check, equality and in predicates by comparing codes with the compressed constants
+  static int fsst_codes_operator(const ObStringColumnDecoderCtx &ctx,
+                                 const int64_t row_start,
+                                 const int64_t row_count,
+                                 const sql::ObWhiteFilterExecutor &filter,
+                                 common::ObBitmap &result_bitmap);
+
+private:
+  static const int64_t MAX_FSST_FILTER_DATUM_CNT = 8;
 };
 
 }  // end namespace blocksstable
@@ -27,7 +27,8 @@ using namespace common;
 
 ObStringColumnEncoder::ObStringColumnEncoder()
   : enc_ctx_(),
-    string_stream_encoder_()
+    string_stream_encoder_(),
+    fsst_table_()
 {
 }
 
@@ -58,6 +59,7 @@ void ObStringColumnEncoder::reuse()
   ObIColumnCSEncoder::reuse();
   enc_ctx_.reset();
   string_stream_encoder_.reuse();
+  fsst_table_.reset();
 }
 
 int ObStringColumnEncoder::do_init_()
@@ -129,11 +131,30 @@ int ObStringColumnEncoder::do_init_()
       ctx_->encoding_ctx_->previous_cs_encoding_.get_column_encoding(column_index_),
       int_stream_idx, ctx_->allocator_))) {
     LOG_WARN("fail to build_string_stream_encoder_info", K(ret));
+  } else if (fixed_len < 0 && !is_force_raw_ && ObStringSC == store_class_
+      && ctx_->encoding_ctx_->major_working_cluster_version_ >= ObCSEncodingUtil::FSST_MIN_DATA_VERSION
+      && OB_FAIL(try_use_fsst_())) {
+    LOG_WARN("fail to try use fsst", K(ret));
   }
 
   return ret;
 }
 
+int ObStringColumnEncoder::try_use_fsst_()
+{
+  int ret = OB_SUCCESS;
+  ObColumnDatumIter iter(*ctx_->col_datums_);
+  uint32_t code_len = 0;
+  bool is_fsst_used = false;
+  if (OB_FAIL(ObCSEncodingUtil::try_build_fsst_table(
+      iter, ctx_->var_data_size_, *ctx_->allocator_, fsst_table_, code_len, is_fsst_used))) {
+    LOG_WARN("fail to try build fsst table", K(ret), KPC_(ctx));
+  } else if (is_fsst_used && OB_FAIL(enc_ctx_.build_fsst_stream_meta(fsst_table_, code_len))) {
+    LOG_WARN("fail to build fsst stream meta", K(ret), K(code_len));
+  }
+  return ret;
+}
+
 int ObStringColumnEncoder::store_column(ObMicroBufferWriter &buf_writer)
 {
   int ret = OB_SUCCESS;
@@ -191,9 +212,11 @@ int64_t ObStringColumnEncoder::estimate_store_size() const
     if (enc_ctx_.meta_.is_fixed_len_string()) {
       size = enc_ctx_.meta_.get_fixed_string_len() * row_count_;
     } else { // variable length string
-      int64_t avg_length = ctx_->var_data_size_ / row_count_;
+      // uncompressed_len_ is the length of fsst codes and symbol table if fsst is used
+      const int64_t str_data_size = enc_ctx_.meta_.uncompressed_len_;
+      int64_t avg_length = str_data_size / row_count_;
       int64_t length_byte_size = ObCSEncodingUtil::get_bit_size(avg_length) * row_count_ / CHAR_BIT;
-      size = ctx_->var_data_size_ + length_byte_size;
+      size = str_data_size + length_byte_size;
     }
     if (column_header_.has_null_bitmap()) {
       size += ObCSEncodingUtil::get_bitmap_byte_size(row_count_);
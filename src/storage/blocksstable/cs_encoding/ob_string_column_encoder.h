@@ -15,6 +15,7 @@
 
 #include "ob_icolumn_cs_encoder.h"
 #include "ob_string_stream_encoder.h"
+#include "ob_fsst_codec.h"
 
 namespace oceanbase
 {
@@ -46,11 +47,13 @@ public:
 
 private:
   int do_init_();
+  int try_use_fsst_();
   int store_column_meta_(ObMicroBufferWriter &buf_writer);
 
 private:
   ObStringStreamEncoderCtx enc_ctx_;
   ObStringStreamEncoder string_stream_encoder_;
+  ObFSSTSymbolTable fsst_table_;
   common::ObCompressor *compressor_;
 };
 
@@ -17,6 +17,7 @@
 #include "lib/compress/ob_compress_util.h"
 #include "ob_column_datum_iter.h"
 #include "ob_integer_stream_encoder.h"
+#include "ob_fsst_codec.h"
 
 namespace oceanbase
 {
@@ -71,8 +72,14 @@ int ObStringStreamEncoder::do_convert_datum_to_stream_(ObIDatumIter &iter)
   int ret = OB_SUCCESS;
   const bool is_fixed_len = ctx_->meta_.is_fixed_len_string();
   const uint32_t umcompress_len = ctx_->meta_.uncompressed_len_;
-
-  if (!is_fixed_len) {
+  // string data is followed by the symbol table if it is fsst compressed
+  const uint32_t str_data_len = ctx_->meta_.get_string_data_len();
+  const ObFSSTSymbolTable *fsst_table = ctx_->meta_.is_fsst_compressed() ? ctx_->info_.fsst_table_ : nullptr;
+
+  if (OB_UNLIKELY(ctx_->meta_.is_fsst_compressed() && nullptr == fsst_table)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "fsst symbol table is null", K(ret), KPC_(ctx));
+  } else if (!is_fixed_len) {
     offset_arr_count_ = (uint32_t)(iter.size());
     int64_t offset_arr_len = offset_arr_count_ * sizeof(T);
     if (umcompress_len + offset_arr_len > all_string_writer_->remain()) {
@@ -118,6 +125,10 @@ int ObStringStreamEncoder::do_convert_datum_to_stream_(ObIDatumIter &iter)
           pos += tmp_len;
         }
       }
+    } else if (nullptr != fsst_table) {
+      if (OB_FAIL(fsst_table->compress(datum->ptr_, datum->len_, byte_arr_, str_data_len, pos))) {
+        STORAGE_LOG(WARN, "fail to fsst compress", KR(ret), K(pos), K(str_data_len), KPC(datum));
+      }
     } else {
       tmp_len = datum->len_;
       if (OB_UNLIKELY((pos + tmp_len) > umcompress_len)) {
@@ -142,9 +153,11 @@ int ObStringStreamEncoder::do_convert_datum_to_stream_(ObIDatumIter &iter)
   }
 
   if (OB_SUCC(ret)) {
-    if (OB_UNLIKELY(i != iter.size() || pos != umcompress_len)) {
+    if (OB_UNLIKELY(i != iter.size() || pos != str_data_len)) {
       ret = OB_ERR_UNEXPECTED;
-      STORAGE_LOG(WARN, "unexpected datum count and bytes len", K(ret), K(i), K(iter.size()), K(pos), K(umcompress_len));
+      STORAGE_LOG(WARN, "unexpected datum count and bytes len", K(ret), K(i), K(iter.size()), K(pos), K(str_data_len));
+    } else if (nullptr != fsst_table && OB_FAIL(fsst_table->serialize(byte_arr_, umcompress_len, pos))) {
+      STORAGE_LOG(WARN, "fail to serialize fsst symbol table", K(ret), K(pos), K(umcompress_len));
     } else if (OB_FAIL(all_string_writer_->advance(umcompress_len))) {
       STORAGE_LOG(WARN, "fail to advance all_string_writer_", K(ret), K(umcompress_len));
     }
@@ -163,7 +176,7 @@ int ObStringStreamEncoder::do_encode_offset_stream_(ObIArray<uint32_t> &stream_o
     ObIntegerStreamEncoder int_encoder;
     T *offset_arr = static_cast<T*>(offset_arr_);
     uint64_t end_offset = offset_arr[offset_arr_count_ - 1];
-    if (OB_UNLIKELY(ctx_->meta_.uncompressed_len_ != end_offset)) {
+    if (OB_UNLIKELY(ctx_->meta_.get_string_data_len() != end_offset)) {
       ret = OB_ERR_UNEXPECTED;
       STORAGE_LOG(WARN, "max string offset must equal to total_bytes_len_", K(ret), K(end_offset), KPC_(ctx));
     } else if (OB_FAIL(int_ctx_.build_offset_array_stream_meta(
@@ -71,6 +71,7 @@ int ObMicroBlockEncoder::try_encoder(ObIColumnEncoder *&encoder, const int64_t c
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid argument", K(ret), K(column_index));
   } else if (ctx_.encoder_opt_.enable<T>()) {
+    col_ctxs_.at(column_index).detected_encoders_[T::type_] = true;
     T *e = alloc_encoder<T>();
     if (NULL == e) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -1497,6 +1498,49 @@ int ObMicroBlockEncoder::try_previous_encoder(ObIColumnEncoder *&choose,
   return ret;
 }
 
+void ObMicroBlockEncoder::mark_skipped_encoders(const int64_t column_index,
+    bool *skipped_encoders, ObColumnEncodingCtx &column_ctx)
+{
+  MEMSET(skipped_encoders, 0, sizeof(bool) * ObColumnHeader::MAX_TYPE);
+  if (column_index < ctx_.encoder_lose_stats_.count()) {
+    const ObEncoderLoseStat &lose_stat = ctx_.encoder_lose_stats_.at(column_index);
+    for (int64_t type = ObColumnHeader::RLE; type < ObColumnHeader::MAX_TYPE; ++type) {
+      if (!column_ctx.detected_encoders_[type] && !lose_stat.need_try(type, ctx_.micro_block_cnt_)) {
+        column_ctx.detected_encoders_[type] = true;
+        skipped_encoders[type] = true;
+      }
+    }
+  }
+}
+
+int ObMicroBlockEncoder::update_encoder_lose_stat(const int64_t column_index,
+    const ObColumnHeader::Type chosen_type, const bool *skipped_encoders,
+    const ObColumnEncodingCtx &column_ctx)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(column_index < 0 || column_index >= ctx_.column_cnt_ || nullptr == skipped_encoders)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(column_index), KP(skipped_encoders));
+  }
+  while (OB_SUCC(ret) && ctx_.encoder_lose_stats_.count() <= column_index) {
+    if (OB_FAIL(ctx_.encoder_lose_stats_.push_back(ObEncoderLoseStat()))) {
+      LOG_WARN("push back encoder lose stat failed", K(ret), K(column_index));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ObEncoderLoseStat &lose_stat = ctx_.encoder_lose_stats_.at(column_index);
+    for (int64_t type = ObColumnHeader::RLE; type < ObColumnHeader::MAX_TYPE; ++type) {
+      if (skipped_encoders[type]) {
+      } else if (chosen_type == type) {
+        lose_stat.win(type);
+      } else if (column_ctx.detected_encoders_[type]) {
+        lose_stat.lose(type);
+      }
+    }
+  }
+  return ret;
+}
+
 template <typename T>
 int ObMicroBlockEncoder::try_span_column_encoder(ObIColumnEncoder *&e,
     const int64_t column_index)
@@ -1511,6 +1555,7 @@ int ObMicroBlockEncoder::try_span_column_encoder(ObIColumnEncoder *&e,
     LOG_WARN("invalid argument", K(ret), K(column_index), "column_cnt", ctx_.column_cnt_);
   } else if (ctx_.encoder_opt_.enable<T>() && !col_ctxs_.at(column_index).is_refed_) {
     bool suitable = false;
+    col_ctxs_.at(column_index).detected_encoders_[T::type_] = true;
     T *encoder = alloc_encoder<T>();
     if (NULL == encoder) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -1554,6 +1599,7 @@ int ObMicroBlockEncoder::try_span_column_encoder(ObIColumnEncoder *&e,
     if (ref_column_index < column_index
         && ObColumnHeader::is_inter_column_encoder(encoders_[ref_column_index]->get_type())) {
     } else {
+      col_ctxs_.at(column_index).detected_encoders_[T::type_] = true;
       T *encoder = alloc_encoder<T>();
       if (NULL == encoder) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -1622,6 +1668,10 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
     bool try_more = true;
     ObIColumnEncoder *choose = e;
     int64_t acceptable_size = choose->calc_size() / 4;
+    // skip the encoders which kept losing in the previous micro blocks of this column,
+    // they are marked as detected so that neither previous encoding nor the trials below retry them.
+    bool skipped_encoders[ObColumnHeader::MAX_TYPE];
+    mark_skipped_encoders(column_idx, skipped_encoders, cc);
     if (OB_FAIL(try_encoder<ObDictEncoder>(e, column_idx))) {
       LOG_WARN("try dict encoder failed", K(ret), K(column_idx));
     } else if (NULL != e) {
@@ -1798,6 +1848,12 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
       }
     }
 
+    if (OB_SUCC(ret)) {
+      if (OB_FAIL(update_encoder_lose_stat(column_idx, choose->get_type(), skipped_encoders, cc))) {
+        LOG_WARN("fail to update encoder lose stat", K(ret), K(column_idx));
+      }
+    }
+
     if (OB_SUCC(ret)) {
       LOG_DEBUG("used encoder", K(column_idx),
           "column_header", choose->get_column_header(),
@@ -121,6 +121,12 @@ private:
   int try_previous_encoder(ObIColumnEncoder *&e,
       const int64_t column_index,
       const int64_t acceptable_size, bool &try_more);
+  // mark the encoders which lose too many times in the previous micro blocks as detected
+  void mark_skipped_encoders(const int64_t column_index, bool *skipped_encoders,
+      ObColumnEncodingCtx &column_ctx);
+  // encoders tried but not chosen lose once, the chosen one resets its lose count
+  int update_encoder_lose_stat(const int64_t column_index, const ObColumnHeader::Type chosen_type,
+      const bool *skipped_encoders, const ObColumnEncodingCtx &column_ctx);
 
   template <typename T>
   int try_span_column_encoder(ObIColumnEncoder *&e, const int64_t column_idx);
@@ -477,6 +477,95 @@ int ObColSumAggregator::eval_double(const common::ObDatum &datum)
   return ret;
 }
 
+int ObColBloomFilterAggregator::init(const ObColDesc &col_desc, ObStorageDatum &result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObIColAggregator::init(col_desc, result))) {
+    LOG_WARN("fail to init ObIColAggregator", K(ret));
+  } else {
+    MEMSET(bits_, 0, sizeof(bits_));
+    if (!can_agg_type(col_desc.col_type_.get_type())) {
+      set_not_aggregate();
+    }
+    LOG_DEBUG("[SKIP INDEX] init bloom filter aggregator", K(col_desc_), K(can_aggregate_));
+  }
+  return ret;
+}
+
+void ObColBloomFilterAggregator::reuse()
+{
+  ObIColAggregator::reuse();
+  MEMSET(bits_, 0, sizeof(bits_));
+  if (!can_agg_type(col_desc_.col_type_.get_type())) {
+    set_not_aggregate();
+  }
+}
+
+int ObColBloomFilterAggregator::eval(const ObStorageDatum &datum, const bool is_data)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (!can_aggregate_) {
+    // Skip
+  } else if (!is_data) {
+    // bloom filter is only kept at micro block level
+    set_not_aggregate();
+  } else if (datum.is_nop() || datum.is_null()) {
+    // null never matches an equal or like predicate, so null data is not recorded
+  } else if (datum.is_outrow()) {
+    set_not_aggregate();
+  } else if (OB_FAIL(add_data(datum))) {
+    LOG_WARN("Fail to add data to bloom filter", K(ret), K(datum), K(col_desc_));
+  }
+  return ret;
+}
+
+int ObColBloomFilterAggregator::get_result(const ObStorageDatum *&result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    int64_t size = 0;
+    if (can_aggregate_) {
+      MEMCPY(result_bits_, bits_, sizeof(bits_));
+      size = ObSkipIndexBloomFilter::shrink(result_bits_, sizeof(result_bits_));
+    }
+    if (size > 0) {
+      result_->set_string(result_bits_, size);
+    } else {
+      result_->set_nop();
+    }
+    result = result_;
+  }
+  return ret;
+}
+
+int ObColBloomFilterAggregator::add_data(const ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash = 0;
+  if (OB_FAIL(ObSkipIndexBloomFilter::calc_hash(col_desc_.col_type_, datum, hash))) {
+    LOG_WARN("Fail to calc hash", K(ret), K(datum), K(col_desc_));
+  } else {
+    ObSkipIndexBloomFilter::insert(hash, bits_, sizeof(bits_));
+  }
+  return ret;
+}
+
+int ObColNgramBloomFilterAggregator::add_data(const ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  const char *ptr = datum.ptr_;
+  for (int64_t i = 0; i + ObSkipIndexBloomFilter::NGRAM_SIZE <= datum.len_; ++i) {
+    ObSkipIndexBloomFilter::insert(ObSkipIndexBloomFilter::calc_ngram_hash(ptr + i), bits_, sizeof(bits_));
+  }
+  return ret;
+}
+
 ObSkipIndexAggregator::ObSkipIndexAggregator()
   : allocator_(nullptr),
     col_aggs_(),
@@ -660,8 +749,8 @@ int ObSkipIndexAggregator::get_aggregated_row(const ObDatumRow *&aggregated_row)
       } else if (OB_ISNULL(result)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("Fail to get aggregated column result", K(ret), K(i));
-      } else if (OB_UNLIKELY(result->len_ > ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH
-          || result->is_outrow())) {
+      } else if (OB_UNLIKELY(result->is_outrow() || result->len_ > (full_agg_metas_->at(i).is_bloom_filter()
+          ? ObSkipIndexBloomFilter::MAX_BLOOM_FILTER_SIZE : ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH))) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("Unexpected aggregated result datum", K(ret), K(result), K(i), K_(full_agg_metas));
       }
@@ -726,6 +815,11 @@ int ObSkipIndexAggregator::calc_max_agg_size(
             cur_max_cell_size += sum_store_size;
             break;
           }
+          case ObSkipIndexColType::SK_IDX_BLOOM_FILTER:
+          case ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER: {
+            cur_max_cell_size += ObSkipIndexBloomFilter::MAX_BLOOM_FILTER_SIZE;
+            break;
+          }
           default: {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("Not support skip index aggregate type", K(ret), K(idx_type));
@@ -792,6 +886,20 @@ int ObSkipIndexAggregator::init_col_aggregators(
         }
         break;
       }
+      case ObSkipIndexColType::SK_IDX_BLOOM_FILTER: {
+        if (OB_FAIL(init_col_aggregator<ObColBloomFilterAggregator>(
+            full_col_descs.at(col_idx), agg_result_->storage_datums_[i], allocator))) {
+          LOG_WARN("Fail to allocate column aggregator", K(ret));
+        }
+        break;
+      }
+      case ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER: {
+        if (OB_FAIL(init_col_aggregator<ObColNgramBloomFilterAggregator>(
+            full_col_descs.at(col_idx), agg_result_->storage_datums_[i], allocator))) {
+          LOG_WARN("Fail to allocate column aggregator", K(ret));
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Not supported skip index aggregate type", K(ret), K(idx_type));
@@ -128,6 +128,40 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObColSumAggregator);
 };
 
+class ObColBloomFilterAggregator : public ObIColAggregator
+{
+public:
+  ObColBloomFilterAggregator() { MEMSET(bits_, 0, sizeof(bits_)); MEMSET(result_bits_, 0, sizeof(result_bits_)); }
+  virtual ~ObColBloomFilterAggregator() {}
+
+  int init(const ObColDesc &col_desc, ObStorageDatum &result) override;
+  void reset() override { new (this) ObColBloomFilterAggregator(); }
+  void reuse() override;
+  int eval(const ObStorageDatum &datum, const bool is_data) override;
+  int get_result(const ObStorageDatum *&result) override;
+protected:
+  virtual bool can_agg_type(const ObObjType type) const { return can_agg_bloom_filter(type); }
+  virtual int add_data(const ObStorageDatum &datum);
+protected:
+  char bits_[ObSkipIndexBloomFilter::MAX_BLOOM_FILTER_SIZE];
+  // bits_ folded to the result size, kept apart since more data may be evaluated after get_result
+  char result_bits_[ObSkipIndexBloomFilter::MAX_BLOOM_FILTER_SIZE];
+  DISALLOW_COPY_AND_ASSIGN(ObColBloomFilterAggregator);
+};
+
+class ObColNgramBloomFilterAggregator : public ObColBloomFilterAggregator
+{
+public:
+  ObColNgramBloomFilterAggregator() {}
+  virtual ~ObColNgramBloomFilterAggregator() {}
+  void reset() override { new (this) ObColNgramBloomFilterAggregator(); }
+protected:
+  bool can_agg_type(const ObObjType type) const override { return can_agg_ngram_bloom_filter(type); }
+  int add_data(const ObStorageDatum &datum) override;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObColNgramBloomFilterAggregator);
+};
+
 class ObSkipIndexAggregator final
 {
 public:
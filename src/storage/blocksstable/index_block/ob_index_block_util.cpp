@@ -12,7 +12,10 @@
 
 #define USING_LOG_PREFIX STORAGE
 
+#include "lib/hash_func/murmur_hash.h"
+#include "share/datum/ob_datum_funcs.h"
 #include "share/schema/ob_schema_struct.h"
+#include "sql/engine/expr/ob_expr.h"
 #include "storage/blocksstable/index_block/ob_index_block_util.h"
 
 namespace oceanbase
@@ -50,6 +53,18 @@ int ObSkipIndexColMeta::append_skip_index_meta(
       STORAGE_LOG(WARN, "failed to push sum skip index meta", K(ret));
     }
   }
+
+  if (OB_SUCC(ret) && skip_idx_attr.has_bloom_filter()) {
+    if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_BLOOM_FILTER)))) {
+      STORAGE_LOG(WARN, "failed to push bloom filter skip index meta", K(ret));
+    }
+  }
+
+  if (OB_SUCC(ret) && skip_idx_attr.has_ngram_bloom_filter()) {
+    if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER)))) {
+      STORAGE_LOG(WARN, "failed to push ngram bloom filter skip index meta", K(ret));
+    }
+  }
   return ret;
 }
 
@@ -95,5 +110,104 @@ int ObSkipIndexColMeta::calc_skip_index_maximum_size(
   return ret;
 }
 
+int64_t ObSkipIndexColMeta::calc_bloom_filter_maximum_size(
+    const share::schema::ObSkipIndexColumnAttr &skip_idx_attr)
+{
+  const int64_t bloom_filter_column_cnt = (skip_idx_attr.has_bloom_filter() ? 1 : 0)
+      + (skip_idx_attr.has_ngram_bloom_filter() ? 1 : 0);
+  return bloom_filter_column_cnt * ObSkipIndexBloomFilter::MAX_BLOOM_FILTER_SIZE;
+}
+
+int64_t ObSkipIndexBloomFilter::shrink(char *bits, const int64_t size)
+{
+  int64_t bit_cnt = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    bit_cnt += __builtin_popcount(static_cast<uint8_t>(bits[i]));
+  }
+  int64_t cur_size = size;
+  if (bit_cnt * 100 > cur_size * 8 * MAX_FILL_PERCENT) {
+    cur_size = 0;
+  } else {
+    bool can_shrink = true;
+    while (can_shrink && cur_size > MIN_BLOOM_FILTER_SIZE) {
+      const int64_t half_size = cur_size / 2;
+      int64_t folded_bit_cnt = 0;
+      for (int64_t i = 0; i < half_size; ++i) {
+        folded_bit_cnt += __builtin_popcount(static_cast<uint8_t>(bits[i] | bits[i + half_size]));
+      }
+      if (folded_bit_cnt * 100 > half_size * 8 * MAX_FILL_PERCENT) {
+        can_shrink = false;
+      } else {
+        for (int64_t i = 0; i < half_size; ++i) {
+          bits[i] |= bits[i + half_size];
+        }
+        cur_size = half_size;
+      }
+    }
+  }
+  return cur_size;
+}
+
+int ObSkipIndexBloomFilter::calc_hash(const ObObjMeta &col_meta, const ObDatum &datum, uint64_t &hash)
+{
+  int ret = OB_SUCCESS;
+  hash = 0;
+  sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(
+      col_meta.get_type(), col_meta.get_collation_type());
+  if (OB_ISNULL(basic_funcs) || OB_ISNULL(basic_funcs->murmur_hash_v2_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null hash func", K(ret), K(col_meta));
+  } else if (OB_FAIL(basic_funcs->murmur_hash_v2_(datum, 0, hash))) {
+    LOG_WARN("failed to calc hash", K(ret), K(col_meta), K(datum));
+  }
+  return ret;
+}
+
+uint64_t ObSkipIndexBloomFilter::calc_ngram_hash(const char *ptr)
+{
+  return murmurhash(ptr, static_cast<int32_t>(NGRAM_SIZE), 0);
+}
+
+bool ObSkipIndexBloomFilter::may_contain_like_pattern(
+    const char *pattern,
+    const int64_t len,
+    const char escape_char,
+    const char *bits,
+    const int64_t size)
+{
+  // escaped characters are treated as segment boundary for simplicity
+  int64_t seg_start = 0;
+  bool may_contain = true;
+  for (int64_t i = 0; may_contain && i <= len; ++i) {
+    const bool is_boundary = i == len || '%' == pattern[i] || '_' == pattern[i] || escape_char == pattern[i];
+    if (is_boundary) {
+      for (int64_t j = seg_start; may_contain && j + NGRAM_SIZE <= i; ++j) {
+        may_contain = ObSkipIndexBloomFilter::may_contain(calc_ngram_hash(pattern + j), bits, size);
+      }
+      if (i < len && escape_char == pattern[i]) {
+        ++i; // skip the escaped character
+      }
+      seg_start = i + 1;
+    }
+  }
+  return may_contain;
+}
+
+bool ObSkipIndexBloomFilter::is_hash_compatible(const ObObjMeta &col_meta, const ObObjMeta &param_meta)
+{
+  bool bret = false;
+  const ObObjTypeClass col_tc = col_meta.get_type_class();
+  const ObObjTypeClass param_tc = param_meta.get_type_class();
+  if (ObIntTC == col_tc || ObUIntTC == col_tc) {
+    // integers are all stored as 8 bytes in datum
+    bret = ObIntTC == param_tc || ObUIntTC == param_tc;
+  } else if (ObStringTC == col_tc) {
+    bret = ObStringTC == param_tc && col_meta.get_collation_type() == param_meta.get_collation_type();
+  } else {
+    bret = col_meta.get_type() == param_meta.get_type();
+  }
+  return bret;
+}
+
 } // namespace blocksstable
 } // namespace oceanbase
\ No newline at end of file
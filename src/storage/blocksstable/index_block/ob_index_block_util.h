@@ -27,7 +27,6 @@ struct ObSkipIndexColumnAttr;
 namespace blocksstable
 {
 
-// Only MIN_MAX skipping index is supported now.
 enum ObSkipIndexType : uint8_t
 {
   MIN_MAX,
@@ -43,6 +42,8 @@ enum ObSkipIndexColType : uint8_t
   SK_IDX_MAX,
   SK_IDX_NULL_COUNT,
   SK_IDX_SUM,
+  SK_IDX_BLOOM_FILTER,
+  SK_IDX_NGRAM_BLOOM_FILTER,
   SK_IDX_MAX_COL_TYPE
 };
 
@@ -51,7 +52,8 @@ struct ObSkipIndexColMeta
   // For data with length larger than 40 bytes(normally string), we will store the prefix as min/max
   static constexpr int64_t MAX_SKIP_INDEX_COL_LENGTH = 40;
   static constexpr int64_t SKIP_INDEX_ROW_SIZE_LIMIT = 1 << 10; // 1kb
-  static constexpr int64_t MAX_AGG_COLUMN_PER_ROW = 4; // min / max / null count / sum
+  static constexpr int64_t SKIP_INDEX_BLOOM_FILTER_SIZE_LIMIT = 4 << 10; // 4kb, bloom filters are not counted in row size limit
+  static constexpr int64_t MAX_AGG_COLUMN_PER_ROW = 6; // min / max / null count / sum / bloom filter / ngram bloom filter
   static constexpr ObObjDatumMapType NULL_CNT_COL_TYPE = OBJ_DATUM_8BYTE_DATA;
   static_assert(common::OBJ_DATUM_NUMBER_RES_SIZE == MAX_SKIP_INDEX_COL_LENGTH,
       "Buffer size of ObStorageDatum and maximum size of skip index data is equal to maximum size of ObNumber");
@@ -59,6 +61,10 @@ struct ObSkipIndexColMeta
   ObSkipIndexColMeta(const uint32_t col_idx, const ObSkipIndexColType col_type)
       : col_idx_(col_idx), col_type_(col_type) {}
   bool is_valid() const { return col_type_ < SK_IDX_MAX_COL_TYPE; }
+  bool is_bloom_filter() const
+  {
+    return SK_IDX_BLOOM_FILTER == col_type_ || SK_IDX_NGRAM_BLOOM_FILTER == col_type_;
+  }
   bool operator <(const ObSkipIndexColMeta &rhs) const
   {
     bool ret = false;
@@ -84,6 +90,7 @@ struct ObSkipIndexColMeta
       const ObObjType obj_type,
       const int16_t precision,
       int64_t &max_size);
+  static int64_t calc_bloom_filter_maximum_size(const share::schema::ObSkipIndexColumnAttr &skip_idx_attr);
 
   TO_STRING_KV(K_(pack), K_(col_idx), K_(col_type));
 
@@ -203,6 +210,74 @@ OB_INLINE static int get_sum_store_size(const ObObjType &obj_type, uint32_t &sum
   return ret;
 }
 
+OB_INLINE static bool can_agg_bloom_filter(const ObObjType &obj_type)
+{
+  // fixed length char and float types are excluded since equal values might have different binary
+  const ObObjTypeClass tc = ob_obj_type_class(obj_type);
+  return ObIntTC == tc || ObUIntTC == tc || ObDateTimeTC == tc || ObDateTC == tc
+      || ObTimeTC == tc || ObYearTC == tc || ObVarcharType == obj_type || ObNVarchar2Type == obj_type;
+}
+
+OB_INLINE static bool can_agg_ngram_bloom_filter(const ObObjType &obj_type)
+{
+  return ObVarcharType == obj_type || ObNVarchar2Type == obj_type;
+}
+
+// Bloom filter stored as an aggregated column of the index row of a micro block.
+// The filter is built in MAX_BLOOM_FILTER_SIZE bytes and folded to the smallest power of 2 size
+// which keeps at most MAX_FILL_PERCENT of bits set, so that its size follows the ndv of the block.
+// A filter still too full at the max size can prune nothing and is not stored.
+// Index rows above the micro block level do not aggregate bloom filters, since the union of their
+// children would be saturated.
+struct ObSkipIndexBloomFilter
+{
+  static constexpr int64_t MIN_BLOOM_FILTER_SIZE = 32; // bytes
+  static constexpr int64_t MAX_BLOOM_FILTER_SIZE = 512; // bytes
+  static constexpr int64_t MAX_FILL_PERCENT = 50;
+  static constexpr int64_t HASH_FUNC_CNT = 3;
+  static constexpr int64_t NGRAM_SIZE = 3;
+
+  // bit position of power of 2 size filter is folded exactly: hash % (bits / 2) == (hash % bits) % (bits / 2)
+  OB_INLINE static void insert(const uint64_t hash, char *bits, const int64_t size)
+  {
+    const uint64_t bit_mask = size * 8 - 1;
+    const uint32_t h1 = static_cast<uint32_t>(hash);
+    const uint32_t h2 = static_cast<uint32_t>(hash >> 32);
+    for (int64_t i = 0; i < HASH_FUNC_CNT; ++i) {
+      const uint64_t bit = (h1 + i * h2) & bit_mask;
+      bits[bit >> 3] |= static_cast<char>(1 << (bit & 7));
+    }
+  }
+  OB_INLINE static bool may_contain(const uint64_t hash, const char *bits, const int64_t size)
+  {
+    bool contain = true;
+    const uint64_t bit_mask = size * 8 - 1;
+    const uint32_t h1 = static_cast<uint32_t>(hash);
+    const uint32_t h2 = static_cast<uint32_t>(hash >> 32);
+    for (int64_t i = 0; contain && i < HASH_FUNC_CNT; ++i) {
+      const uint64_t bit = (h1 + i * h2) & bit_mask;
+      contain = 0 != (bits[bit >> 3] & (1 << (bit & 7)));
+    }
+    return contain;
+  }
+  OB_INLINE static bool is_valid_size(const int64_t size)
+  {
+    return size >= MIN_BLOOM_FILTER_SIZE && size <= MAX_BLOOM_FILTER_SIZE && 0 == (size & (size - 1));
+  }
+  // fold @bits of @size bytes in place, return the folded size, or 0 if the filter is saturated
+  static int64_t shrink(char *bits, const int64_t size);
+  // hash is calculated with the hash function of column type, so that values compared as equal
+  // under the collation of column get the same hash
+  static int calc_hash(const ObObjMeta &col_meta, const ObDatum &datum, uint64_t &hash);
+  static uint64_t calc_ngram_hash(const char *ptr);
+  // whether a string matching the like @pattern may exist in ngram bloom filter @bits, every ngram
+  // of the literal segments in the pattern must exist in matched strings
+  static bool may_contain_like_pattern(const char *pattern, const int64_t len, const char escape_char,
+                                       const char *bits, const int64_t size);
+  // whether the hash of @param_meta datum is comparable with the hash of @col_meta datum
+  static bool is_hash_compatible(const ObObjMeta &col_meta, const ObObjMeta &param_meta);
+};
+
 } // blocksstable
 } // oceanbase
 
@@ -84,6 +84,14 @@ int ObSkipIndexFilterExecutor::falsifiable_pushdown_filter(
         }
         break;
       }
+      case ObSkipIndexType::BLOOM_FILTER: {
+        if (filter.is_filter_dynamic_node()) {
+          filter.get_filter_bool_mask().set_uncertain();
+        } else if (OB_FAIL(filter_on_bloom_filter(col_idx, obj_meta, filter))) {
+          LOG_WARN("Fail to filter on bloom filter", K(ret), K(col_idx));
+        }
+        break;
+      }
       default :
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("unsupported skip index type", K(ret), K(index_type));
@@ -93,6 +101,121 @@ int ObSkipIndexFilterExecutor::falsifiable_pushdown_filter(
   return ret;
 }
 
+int ObSkipIndexFilterExecutor::falsifiable_pushdown_filter(
+    const uint32_t col_idx,
+    const ObObjMeta &obj_meta,
+    const ObSkipIndexType index_type,
+    const ObMicroIndexInfo &index_info,
+    sql::ObBlackFilterExecutor &filter)
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_UNLIKELY(!index_info.has_agg_data())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(index_info));
+  } else if (OB_UNLIKELY(ObSkipIndexType::NGRAM_BLOOM_FILTER != index_type)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("unsupported skip index type for black filter", K(ret), K(index_type));
+  } else if (OB_FAIL(agg_row_reader_.init(index_info.agg_row_buf_, index_info.agg_buf_size_))) {
+    LOG_WARN("failed to init agg row reader", K(ret));
+  } else if (OB_FAIL(filter_on_ngram_bloom_filter(col_idx, obj_meta, filter))) {
+    LOG_WARN("Fail to filter on ngram bloom filter", K(ret), K(col_idx));
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::read_bloom_filter(
+    const uint32_t col_idx,
+    const ObSkipIndexColType col_type,
+    ObStorageDatum &bloom_filter)
+{
+  int ret = OB_SUCCESS;
+  meta_.col_idx_ = col_idx;
+  meta_.col_type_ = col_type;
+  if (OB_FAIL(agg_row_reader_.read(meta_, bloom_filter))) {
+    LOG_WARN("Failed read agg bloom filter", K(ret), K(meta_));
+  } else if (OB_UNLIKELY(!bloom_filter.is_null()
+      && !ObSkipIndexBloomFilter::is_valid_size(bloom_filter.len_))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected bloom filter length", K(ret), K(meta_), K(bloom_filter));
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::filter_on_bloom_filter(
+    const uint32_t col_idx,
+    const ObObjMeta &obj_meta,
+    sql::ObWhiteFilterExecutor &filter)
+{
+  int ret = OB_SUCCESS;
+  sql::ObBoolMask &fal_desc = filter.get_filter_bool_mask();
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  ObStorageDatum bloom_filter;
+  fal_desc.set_uncertain();
+  if (OB_UNLIKELY(sql::WHITE_OP_EQ != op_type && sql::WHITE_OP_IN != op_type)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected filter type for bloom filter", K(ret), K(op_type));
+  } else if (filter.null_param_contained()) {
+    // leave it to min max skipping index
+  } else if (OB_FAIL(read_bloom_filter(col_idx, SK_IDX_BLOOM_FILTER, bloom_filter))) {
+    LOG_WARN("Failed to read bloom filter", K(ret), K(col_idx));
+  } else if (bloom_filter.is_null()) {
+    // not aggregated, e.g. data written before the bloom filter skip index is added
+  } else {
+    // a block with none of the filter values in bloom filter is always false,
+    // but bloom filter can never prove a block always true
+    const common::ObIArray<common::ObDatum> &datums = filter.get_datums();
+    bool may_contain = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !may_contain && i < datums.count(); ++i) {
+      uint64_t hash = 0;
+      if (datums.at(i).is_null()) {
+      } else if (OB_FAIL(ObSkipIndexBloomFilter::calc_hash(obj_meta, datums.at(i), hash))) {
+        LOG_WARN("Failed to calc hash", K(ret), K(obj_meta), K(datums.at(i)));
+      } else {
+        may_contain = ObSkipIndexBloomFilter::may_contain(hash, bloom_filter.ptr_, bloom_filter.len_);
+      }
+    }
+    if (OB_SUCC(ret) && !may_contain) {
+      fal_desc.set_always_false();
+    }
+  }
+  LOG_DEBUG("[SKIP INDEX] filter on bloom filter", K(ret), K(col_idx), K(fal_desc));
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::filter_on_ngram_bloom_filter(
+    const uint32_t col_idx,
+    const ObObjMeta &obj_meta,
+    sql::ObBlackFilterExecutor &filter)
+{
+  int ret = OB_SUCCESS;
+  sql::ObBoolMask &fal_desc = filter.get_filter_bool_mask();
+  const sql::ObExpr *column_expr = nullptr;
+  const common::ObDatum *pattern = nullptr;
+  const common::ObDatum *escape = nullptr;
+  ObStorageDatum bloom_filter;
+  fal_desc.set_uncertain();
+  if (OB_FAIL(filter.get_like_pattern(column_expr, pattern, escape))) {
+    LOG_WARN("Failed to get like pattern", K(ret));
+  } else if (OB_ISNULL(column_expr) || pattern->is_null() || escape->len_ > 1) {
+    // not a single byte escaped like on column
+  } else if (!ObCharset::is_bin_sort(obj_meta.get_collation_type())) {
+    // ngram of bytes is not valid under case insensitive collations
+  } else if (OB_FAIL(read_bloom_filter(col_idx, SK_IDX_NGRAM_BLOOM_FILTER, bloom_filter))) {
+    LOG_WARN("Failed to read ngram bloom filter", K(ret), K(col_idx));
+  } else if (bloom_filter.is_null()) {
+    // not aggregated
+  } else {
+    const char escape_char = 1 == escape->len_ ? escape->ptr_[0] : '\\';
+    if (!ObSkipIndexBloomFilter::may_contain_like_pattern(
+        pattern->ptr_, pattern->len_, escape_char, bloom_filter.ptr_, bloom_filter.len_)) {
+      fal_desc.set_always_false();
+    }
+  }
+  LOG_DEBUG("[SKIP INDEX] filter on ngram bloom filter", K(ret), K(col_idx), K(fal_desc));
+  return ret;
+}
+
 int ObSkipIndexFilterExecutor::filter_on_min_max(
     const uint32_t col_idx,
     const uint64_t row_count,
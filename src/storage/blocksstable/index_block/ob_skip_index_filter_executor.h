@@ -40,6 +40,12 @@ public:
                                   const ObMicroIndexInfo &index_info,
                                   sql::ObWhiteFilterExecutor &filter,
                                   common::ObIAllocator &allocator);
+  // only NGRAM_BLOOM_FILTER on `col LIKE pattern` is supported for black filter
+  int falsifiable_pushdown_filter(const uint32_t col_idx,
+                                  const ObObjMeta &obj_meta,
+                                  const ObSkipIndexType index_type,
+                                  const ObMicroIndexInfo &index_info,
+                                  sql::ObBlackFilterExecutor &filter);
 
 private:
   int filter_on_min_max(const uint32_t col_idx,
@@ -48,6 +54,16 @@ private:
                         sql::ObWhiteFilterExecutor &filter,
                         common::ObIAllocator &allocator);
 
+  int filter_on_bloom_filter(const uint32_t col_idx,
+                             const ObObjMeta &obj_meta,
+                             sql::ObWhiteFilterExecutor &filter);
+  int filter_on_ngram_bloom_filter(const uint32_t col_idx,
+                                   const ObObjMeta &obj_meta,
+                                   sql::ObBlackFilterExecutor &filter);
+  int read_bloom_filter(const uint32_t col_idx,
+                        const ObSkipIndexColType col_type,
+                        ObStorageDatum &bloom_filter);
+
   int read_aggregate_data(const uint32_t col_idx,
                    common::ObIAllocator &allocator,
                    const share::schema::ObColumnParam *col_param,
@@ -440,6 +440,39 @@ struct ObPreviousEncodingArray<1>
   TO_STRING_KV(K_(prev_encodings));
 };
 
+// Number of continuous micro blocks in which an encoder was tried for a column but not chosen.
+// The encoder is not tried any more after losing SKIP_LOSE_CNT times, except in every
+// RETRY_CYCLE_CNT micro blocks to follow the change of data.
+// Only the encoders from RLE on are tracked: RAW and DICT are the fallbacks which are
+// always tried, so their lose counts stay 0.
+// Only the number of trials is cut down, the encoder is still chosen by the encoded size
+// among the ones tried. There is no decode cost model to weigh the encoders: the size
+// based choice is what the readers are tuned for, and scan speed is already preferred by
+// the SELECTIVE_ENCODING row store type. The saved cpu shows up in the micro block build
+// time, so no separate counter is reported.
+struct ObEncoderLoseStat
+{
+  static const uint8_t SKIP_LOSE_CNT = 8;
+  static const int64_t RETRY_CYCLE_CNT = 32;
+  uint8_t lose_cnts_[ObColumnHeader::MAX_TYPE];
+
+  ObEncoderLoseStat() { reuse(); }
+  void reuse() { MEMSET(lose_cnts_, 0, sizeof(lose_cnts_)); }
+  OB_INLINE bool need_try(const int64_t type, const int64_t micro_block_cnt) const
+  {
+    return lose_cnts_[type] < SKIP_LOSE_CNT || 0 == micro_block_cnt % RETRY_CYCLE_CNT;
+  }
+  OB_INLINE void lose(const int64_t type)
+  {
+    if (lose_cnts_[type] < UINT8_MAX) {
+      ++lose_cnts_[type];
+    }
+  }
+  OB_INLINE void win(const int64_t type) { lose_cnts_[type] = 0; }
+
+  TO_STRING_KV("lose_cnts", common::ObArrayWrap<uint8_t>(lose_cnts_, ObColumnHeader::MAX_TYPE));
+};
+
 struct ObMicroBlockEncodingCtx
 {
   static const int64_t MAX_PREV_ENCODING_COUNT = 2;
@@ -455,6 +488,7 @@ struct ObMicroBlockEncodingCtx
   mutable int64_t real_block_size_;
   mutable int64_t micro_block_cnt_; // build micro block count
   mutable common::ObArray<ObPreviousEncodingArray<MAX_PREV_ENCODING_COUNT> > previous_encodings_;
+  mutable common::ObArray<ObEncoderLoseStat> encoder_lose_stats_;
   mutable ObPreviousCSEncoding previous_cs_encoding_;
 
   int64_t *column_encodings_;
@@ -467,12 +501,13 @@ struct ObMicroBlockEncodingCtx
     rowkey_column_cnt_(0), column_cnt_(0), col_descs_(nullptr),
     encoder_opt_(), cs_encoding_opt_(), estimate_block_size_(0),
     real_block_size_(0), micro_block_cnt_(0),
-    previous_encodings_(), previous_cs_encoding_(),
+    previous_encodings_(), encoder_lose_stats_(), previous_cs_encoding_(),
     column_encodings_(nullptr), major_working_cluster_version_(0),
     row_store_type_(ENCODING_ROW_STORE), need_calc_column_chksum_(false),
     compressor_type_(INVALID_COMPRESSOR)
   {
     previous_encodings_.set_attr(ObMemAttr(MTL_ID(), "MicroEncodeCtx"));
+    encoder_lose_stats_.set_attr(ObMemAttr(MTL_ID(), "MicroEncodeCtx"));
   }
   bool is_valid() const;
   TO_STRING_KV(K_(macro_block_size), K_(micro_block_size), K_(rowkey_column_cnt),
@@ -725,6 +725,7 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block, cons
         STORAGE_LOG(WARN, "Failed to write micro block, ", K(ret), K(micro_block_desc));
       } else if (NULL != merge_info_) {
         merge_info_->multiplexed_micro_count_in_new_macro_++;
+        merge_info_->multiplexed_micro_size_in_new_macro_ += micro_block_desc.buf_size_;
       }
 
       if (OB_SUCC(ret) && nullptr != data_aggregator_) {
@@ -1540,11 +1541,13 @@ int ObMacroBlockWriter::check_micro_block_need_merge(
     ObRowStoreType row_store_type = static_cast<ObRowStoreType>(micro_block.header_.row_store_type_);
     if (row_store_type != data_store_desc_->get_row_store_type()) {
       need_merge = true;
-    } else if (micro_writer_->get_row_count() <= 0
-        && micro_block.header_.data_length_ > data_store_desc_->get_micro_block_size() / 2) {
-      need_merge = false;
-    } else if (micro_writer_->get_block_size() > data_store_desc_->get_micro_block_size() / 2
-        && micro_block.header_.data_length_ > data_store_desc_->get_micro_block_size() / 2) {
+    } else if (micro_block.header_.data_length_ > data_store_desc_->get_micro_block_size() / 2
+        && (micro_writer_->get_row_count() <= 0
+            || micro_writer_->get_block_size() >= data_store_desc_->get_micro_block_size() / 4)) {
+      // the rows in micro writer are built to a separate micro block before reusing. Tiny pending
+      // rows are merged with the big micro block instead, since they would be left as a tiny micro
+      // block which is never merged with its reused neighbours. The merged block is built as soon as
+      // it is full, so the following unchanged micro blocks are still reused
       need_merge = false;
     } else {
       need_merge = true;
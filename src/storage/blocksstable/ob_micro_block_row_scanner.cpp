@@ -1155,6 +1155,10 @@ void ObMultiVersionMicroBlockRowScanner::reuse()
   finish_scanning_cur_rowkey_ = true;
   is_last_multi_version_row_ = true;
   read_row_direct_flag_ = false;
+  last_trans_id_.reset();
+  last_sql_seq_.reset();
+  last_trans_version_ = INT64_MAX;
+  last_can_read_ = false;
 }
 
 void ObMultiVersionMicroBlockRowScanner::inner_reset()
@@ -1196,6 +1200,8 @@ int ObMultiVersionMicroBlockRowScanner::switch_context(
     sql_sequence_col_idx_ = ObMultiVersionRowkeyHelpper::get_sql_sequence_col_store_index(
         read_info_->get_schema_rowkey_count(), true);
     version_range_ = context.trans_version_range_;
+    last_trans_id_.reset();
+    last_sql_seq_.reset();
   }
   return ret;
 }
@@ -1876,12 +1882,22 @@ int ObMultiVersionMicroBlockRowScanner::lock_for_read(
   auto &tx_table_guards = context_->store_ctx_->mvcc_acc_ctx_.get_tx_table_guards();
   int64_t cost_time = common::ObClockGenerator::getClock();
 
-  if (OB_FAIL(tx_table_guards.lock_for_read(lock_for_read_arg,
-                                            can_read,
-                                            scn_trans_version))) {
+  if (last_trans_id_.is_valid()
+      && last_trans_id_ == lock_for_read_arg.data_trans_id_
+      && last_sql_seq_ == lock_for_read_arg.data_sql_sequence_) {
+    // the snapshot of the scan is unchanged, so the same txn and sequence have the same result
+    can_read = last_can_read_;
+    trans_version = last_trans_version_;
+  } else if (OB_FAIL(tx_table_guards.lock_for_read(lock_for_read_arg,
+                                                   can_read,
+                                                   scn_trans_version))) {
     LOG_WARN("failed to check transaction status", K(ret));
   } else {
     trans_version = scn_trans_version.get_val_for_tx();
+    last_trans_id_ = lock_for_read_arg.data_trans_id_;
+    last_sql_seq_ = lock_for_read_arg.data_sql_sequence_;
+    last_trans_version_ = trans_version;
+    last_can_read_ = can_read;
     if (OB_NOT_NULL(context_->trans_state_mgr_) &&
       OB_TMP_FAIL(context_->trans_state_mgr_->add_trans_state(
         lock_for_read_arg.data_trans_id_, lock_for_read_arg.data_sql_sequence_,
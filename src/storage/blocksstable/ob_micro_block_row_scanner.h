@@ -278,7 +278,11 @@ public:
         trans_version_col_idx_(-1),
         sql_sequence_col_idx_(-1),
         cell_cnt_(0),
-        read_row_direct_flag_(false)
+        read_row_direct_flag_(false),
+        last_trans_id_(),
+        last_sql_seq_(),
+        last_trans_version_(INT64_MAX),
+        last_can_read_(false)
   {}
   virtual ~ObMultiVersionMicroBlockRowScanner() {}
   void reuse() override;
@@ -345,6 +349,12 @@ private:
   int64_t cell_cnt_;
   common::ObVersionRange version_range_;
   bool read_row_direct_flag_;
+  // result of the latest lock_for_read, uncommitted rows of one txn are usually stored
+  // together, so the following rows of the same txn do not need to look up the tx table again
+  transaction::ObTransID last_trans_id_;
+  transaction::ObTxSEQ last_sql_seq_;
+  int64_t last_trans_version_;
+  bool last_can_read_;
 };
 
 // multi version sstable micro block scanner for minor merge
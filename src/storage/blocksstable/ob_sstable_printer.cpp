@@ -665,6 +665,13 @@ void ObSSTablePrinter::print_cs_encoding_column_meta(
     print_line("dict_meta.attrs", dict_meta->attrs_);
     print_line("dict_meta.distinct_val_cnt", dict_meta->distinct_val_cnt_);
     print_line("dict_meta.ref_row_cnt", dict_meta->ref_row_cnt_);
+  } else if (ObCSColumnHeader::Type::FLOAT == type) {
+    const ObFloatEncodingMeta *float_meta = reinterpret_cast<const ObFloatEncodingMeta *>(start);
+    print_line("float_meta.version", float_meta->version_);
+    print_line("float_meta.attrs", float_meta->attrs_);
+    print_line("float_meta.exponent", float_meta->exponent_);
+    print_line("float_meta.factor", float_meta->factor_);
+    print_line("float_meta.exception_cnt", float_meta->exception_cnt_);
   } else {
     print_line("has_nullbitmap", (0 != len));
   }
@@ -702,6 +709,7 @@ void ObSSTablePrinter::print_string_stream_decoder_ctx(
   print_line("str_meta.attr", ctx.meta_.attr_, 2);
   print_line("str_meta.fixed_str_len", ctx.meta_.fixed_str_len_, 2);
   print_line("str.meta.uncompressed_len", ctx.meta_.uncompressed_len_, 2);
+  print_line("str_meta.fsst_table_len", ctx.meta_.fsst_table_len_, 2);
 }
 
 void ObSSTablePrinter::print_cs_encoding_orig_stream_data(
@@ -37,7 +37,8 @@ ObCOSSTableRowsFilter::ObCOSSTableRowsFilter()
     filter_iters_(),
     iter_filter_node_(),
     bitmap_buffer_(),
-    pd_filter_info_()
+    pd_filter_info_(),
+    adaptive_and_filters_()
 {
 }
 
@@ -77,6 +78,9 @@ int ObCOSSTableRowsFilter::init(
     } else if (FALSE_IT(depth = nullptr == context.sample_filter_ ? depth : depth + 1)) {
     } else if (OB_FAIL(init_bitmap_buffer(depth))) {
       LOG_WARN("Failed to init bitmap buffer", K(ret), K(depth));
+    } else if (nullptr != filter_ && param.enable_pd_filter_reorder() &&
+               OB_FAIL(init_adaptive_and_filters(filter_))) {
+      LOG_WARN("Failed to init adaptive and filters", K(ret), KPC_(filter));
     } else {
       is_inited_ = true;
     }
@@ -184,6 +188,7 @@ void ObCOSSTableRowsFilter::reset()
   }
   bitmap_buffer_.reset();
   pd_filter_info_.reset();
+  adaptive_and_filters_.reset();
   allocator_ = nullptr;
 }
 
@@ -295,14 +300,28 @@ int ObCOSSTableRowsFilter::apply_filter(
                K(filter->get_child_count()), KP(filter));
     } else {
       sql::ObPushdownFilterExecutor **children = filter->get_childs();
+      ObAdaptiveAndFilter *adaptive_filter = get_adaptive_and_filter(filter);
       bool is_skip = false;
+      uint64_t input_cnt = 0;
+      // children of adaptive filter are not filtered in the order of iter idx,
+      // locate all of them in advance
+      if (nullptr != adaptive_filter) {
+        if (OB_FAIL(try_locating_cg_iters(adaptive_filter->max_iter_idx_ - adaptive_filter->child_cnt_ + 1,
+                                          adaptive_filter->max_iter_idx_,
+                                          range))) {
+          LOG_WARN("Failed to locate", K(ret), K(range), KPC(adaptive_filter));
+        } else {
+          input_cnt = result->popcnt();
+        }
+      }
       for (uint32_t i = 0; OB_SUCC(ret) && i < filter->get_child_count(); ++i) {
+        const uint32_t child_idx = nullptr == adaptive_filter ? i : adaptive_filter->order_[i];
         const ObCGBitmap *child_result = nullptr;
-        if (OB_ISNULL(children[i])) {
+        if (OB_ISNULL(children[child_idx])) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("Unexpected null child filter", K(ret));
-        } else if (OB_FAIL(apply_filter(filter, children[i], range, depth + 1))) {
-          LOG_WARN("Failed to apply filter", K(ret), K(i), KP(children[i]));
+        } else if (OB_FAIL(apply_filter(filter, children[child_idx], range, depth + 1))) {
+          LOG_WARN("Failed to apply filter", K(ret), K(child_idx), KP(children[child_idx]));
         } else if (OB_ISNULL(child_result = get_child_bitmap(depth))) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("Unexpected get null filter bitmap", K(ret));
@@ -310,14 +329,23 @@ int ObCOSSTableRowsFilter::apply_filter(
                                              is_skip))) {
           LOG_WARN("Failed to post apply filter", K(ret), KP(result),
                    KP(child_result));
-        } else if (!is_skip) {
-          if (OB_FAIL(try_locating_cg_iter(subtree_filter_iter_to_filter_, range))) {
+        } else {
+          if (nullptr != adaptive_filter) {
+            const uint64_t output_cnt = is_skip ? 0 : result->popcnt();
+            adaptive_filter->add_stat(child_idx, input_cnt, output_cnt);
+            input_cnt = output_cnt;
+          }
+          if (is_skip) {
+            break;
+          } else if (OB_FAIL(try_locating_cg_iter(subtree_filter_iter_to_filter_, range))) {
             LOG_WARN("Failed to locate", K(ret), K(range), K_(subtree_filter_iter_to_filter));
           }
-        } else {
-          break;
         }
       }
+      if (OB_SUCC(ret) && nullptr != adaptive_filter) {
+        subtree_filter_iter_to_filter_ = MAX(subtree_filter_iter_to_filter_, adaptive_filter->max_iter_idx_ + 1);
+        adaptive_filter->try_reorder();
+      }
     }
   } else {
     ret = OB_ERR_UNEXPECTED;
@@ -326,6 +354,108 @@ int ObCOSSTableRowsFilter::apply_filter(
   return ret;
 }
 
+ObCOSSTableRowsFilter::ObAdaptiveAndFilter::ObAdaptiveAndFilter()
+  : filter_(nullptr),
+    max_iter_idx_(sql::ObPushdownFilterExecutor::INVALID_CG_ITER_IDX),
+    child_cnt_(0),
+    batch_cnt_(0)
+{
+  for (uint32_t i = 0; i < MAX_CHILD_CNT; ++i) {
+    order_[i] = i;
+  }
+  MEMSET(input_cnts_, 0, sizeof(input_cnts_));
+  MEMSET(output_cnts_, 0, sizeof(output_cnts_));
+}
+
+void ObCOSSTableRowsFilter::ObAdaptiveAndFilter::add_stat(
+    const uint32_t child_idx,
+    const uint64_t input_cnt,
+    const uint64_t output_cnt)
+{
+  if (OB_LIKELY(child_idx < child_cnt_)) {
+    input_cnts_[child_idx] += input_cnt;
+    output_cnts_[child_idx] += output_cnt;
+  }
+}
+
+void ObCOSSTableRowsFilter::ObAdaptiveAndFilter::try_reorder()
+{
+  if (0 == (++batch_cnt_ % REORDER_INTERVAL)) {
+    // stable insertion sort by pass ratio, children without stat keep their position behind
+    double ratios[MAX_CHILD_CNT];
+    for (uint32_t i = 0; i < child_cnt_; ++i) {
+      ratios[i] = 0 == input_cnts_[i] ? 1.0 : static_cast<double>(output_cnts_[i]) / input_cnts_[i];
+    }
+    for (uint32_t i = 1; i < child_cnt_; ++i) {
+      const uint32_t child_idx = order_[i];
+      uint32_t j = i;
+      for (; j > 0 && ratios[order_[j - 1]] > ratios[child_idx]; --j) {
+        order_[j] = order_[j - 1];
+      }
+      order_[j] = child_idx;
+    }
+    for (uint32_t i = 0; i < child_cnt_; ++i) {
+      input_cnts_[i] >>= 1;
+      output_cnts_[i] >>= 1;
+    }
+    LOG_DEBUG("[COLUMNSTORE] reorder and filter", KPC(this));
+  }
+}
+
+int ObCOSSTableRowsFilter::init_adaptive_and_filters(sql::ObPushdownFilterExecutor *filter)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(filter)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(filter));
+  } else if (filter->is_logic_op_node() &&
+             sql::ObPushdownFilterExecutor::INVALID_CG_ITER_IDX == filter->get_cg_iter_idx()) {
+    sql::ObPushdownFilterExecutor **children = filter->get_childs();
+    const uint32_t child_cnt = filter->get_child_count();
+    if (filter->is_logic_and_node() && child_cnt <= ObAdaptiveAndFilter::MAX_CHILD_CNT) {
+      // runtime filter and sample filter are kept in place, the iter idxes of children
+      // must be continuous so that all of them can be located by the iter idx range
+      bool is_adaptive = true;
+      const int64_t min_iter_idx = children[0]->get_cg_iter_idx();
+      for (uint32_t i = 0; is_adaptive && i < child_cnt; ++i) {
+        const sql::ObPushdownFilterExecutor *child = children[i];
+        is_adaptive = nullptr != child
+            && (child->is_filter_black_node() || child->is_filter_white_node())
+            && !child->is_filter_dynamic_node()
+            && sql::ObPushdownFilterExecutor::INVALID_CG_ITER_IDX != child->get_cg_iter_idx()
+            && min_iter_idx + i == child->get_cg_iter_idx();
+      }
+      if (is_adaptive) {
+        ObAdaptiveAndFilter adaptive_filter;
+        adaptive_filter.filter_ = filter;
+        adaptive_filter.max_iter_idx_ = min_iter_idx + child_cnt - 1;
+        adaptive_filter.child_cnt_ = child_cnt;
+        if (OB_FAIL(adaptive_and_filters_.push_back(adaptive_filter))) {
+          LOG_WARN("Failed to push back adaptive and filter", K(ret), K(adaptive_filter));
+        }
+      }
+    }
+    for (uint32_t i = 0; OB_SUCC(ret) && i < child_cnt; ++i) {
+      if (children[i]->is_logic_op_node() && OB_FAIL(init_adaptive_and_filters(children[i]))) {
+        LOG_WARN("Failed to init adaptive and filters", K(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
+
+ObCOSSTableRowsFilter::ObAdaptiveAndFilter *ObCOSSTableRowsFilter::get_adaptive_and_filter(
+    const sql::ObPushdownFilterExecutor *filter)
+{
+  ObAdaptiveAndFilter *adaptive_filter = nullptr;
+  for (int64_t i = 0; nullptr == adaptive_filter && i < adaptive_and_filters_.count(); ++i) {
+    if (adaptive_and_filters_.at(i).filter_ == filter) {
+      adaptive_filter = &adaptive_and_filters_.at(i);
+    }
+  }
+  return adaptive_filter;
+}
+
 int ObCOSSTableRowsFilter::post_apply_filter(
     sql::ObPushdownFilterExecutor &filter,
     ObCGBitmap &result,
@@ -634,6 +764,30 @@ int ObCOSSTableRowsFilter::try_locating_cg_iter(
   return ret;
 }
 
+// Unlike try_locating_cg_iter, every iter in [min_iter_idx, max_iter_idx] is located.
+// The iters before min_iter_idx which are not located yet belong to the skipped filters.
+int ObCOSSTableRowsFilter::try_locating_cg_iters(
+    const int64_t min_iter_idx,
+    const int64_t max_iter_idx,
+    const ObCSRange &range)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(min_iter_idx < 0 || max_iter_idx < min_iter_idx
+                  || max_iter_idx >= filter_iters_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(min_iter_idx), K(max_iter_idx), K(filter_iters_.count()));
+  } else if (OB_FAIL(try_locating_cg_iter(min_iter_idx, range))) {
+    LOG_WARN("Failed to locate", K(ret), K(range), K(min_iter_idx));
+  }
+  for (; OB_SUCC(ret) && subtree_filter_iter_to_locate_ <= max_iter_idx; ++subtree_filter_iter_to_locate_) {
+    if (OB_FAIL(filter_iters_[subtree_filter_iter_to_locate_]->locate(range))) {
+      LOG_WARN("Failed to locate cg iter", K(ret), K(range), K_(subtree_filter_iter_to_locate),
+               KP(filter_iters_[subtree_filter_iter_to_locate_]));
+    }
+  }
+  return ret;
+}
+
 int ObCOSSTableRowsFilter::init_bitmap_buffer(uint32_t bitmap_buffer_count)
 {
   int ret = OB_SUCCESS;
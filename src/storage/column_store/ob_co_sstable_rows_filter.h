@@ -59,9 +59,36 @@ public:
       ObICGIterator *&cg_iter);
   TO_STRING_KV(K_(is_inited), K_(subtree_filter_iter_to_locate), K_(batch_size),
       KPC_(iter_param), KP_(access_ctx), KP_(co_sstable), K_(filter), K_(filter_iters),
-      K_(iter_filter_node), K_(bitmap_buffer), K_(pd_filter_info));
+      K_(iter_filter_node), K_(bitmap_buffer), K_(pd_filter_info), K_(adaptive_and_filters));
 
 private:
+  // The children of an AND node which are all filtered by their own column group iterators
+  // are evaluated in the order of measured pass ratio, the most selective one first, so that
+  // the following column groups only decode the micro blocks which still have selected rows.
+  struct ObAdaptiveAndFilter
+  {
+    static const uint32_t MAX_CHILD_CNT = 8;
+    // reorder children and decay the stat every REORDER_INTERVAL batches
+    static const uint32_t REORDER_INTERVAL = 8;
+    ObAdaptiveAndFilter();
+    void add_stat(const uint32_t child_idx, const uint64_t input_cnt, const uint64_t output_cnt);
+    void try_reorder();
+    TO_STRING_KV(KP_(filter), K_(max_iter_idx), K_(child_cnt), K_(batch_cnt),
+        "order", common::ObArrayWrap<uint32_t>(order_, child_cnt_),
+        "input_cnts", common::ObArrayWrap<uint64_t>(input_cnts_, child_cnt_),
+        "output_cnts", common::ObArrayWrap<uint64_t>(output_cnts_, child_cnt_));
+
+    sql::ObPushdownFilterExecutor *filter_;
+    int64_t max_iter_idx_;
+    uint32_t child_cnt_;
+    uint32_t batch_cnt_;
+    uint32_t order_[MAX_CHILD_CNT];
+    // rows passed to and selected by each child, indexed by child idx
+    uint64_t input_cnts_[MAX_CHILD_CNT];
+    uint64_t output_cnts_[MAX_CHILD_CNT];
+  };
+  int init_adaptive_and_filters(sql::ObPushdownFilterExecutor *filter);
+  ObAdaptiveAndFilter *get_adaptive_and_filter(const sql::ObPushdownFilterExecutor *filter);
   int apply_filter(
       sql::ObPushdownFilterExecutor *parent,
       sql::ObPushdownFilterExecutor *filter,
@@ -94,6 +121,10 @@ private:
   int try_locating_cg_iter(
       const int64_t iter_idx_to_filter_next,
       const ObCSRange &range);
+  int try_locating_cg_iters(
+      const int64_t min_iter_idx,
+      const int64_t max_iter_idx,
+      const ObCSRange &range);
   int prepare_bitmap_buffer(
       const ObCSRange &range,
       const uint32_t buffer_idx,
@@ -131,6 +162,7 @@ private:
   ObSEArray<sql::ObPushdownFilterExecutor*, 4> iter_filter_node_;
   ObSEArray<ObCGBitmap*, 4> bitmap_buffer_;
   sql::PushdownFilterInfo pd_filter_info_;
+  ObSEArray<ObAdaptiveAndFilter, 2> adaptive_and_filters_;
 };
 }
 }
@@ -89,9 +89,11 @@ int ObMvccEngine::try_compact_row_when_mvcc_read_(const SCN &snapshot_version,
   if (SCN::min_scn() >= snapshot_version) {
     ret = OB_ERR_UNEXPECTED;
     TRANS_LOG(WARN, "invalid snapshot version", K(ret), K(snapshot_version));
-  } else if (SCN::max_scn() == snapshot_version
-      || ObTimeUtility::current_time() < latest_compact_ts + WEAK_READ_COMPACT_THRESHOLD) {
+  } else if (SCN::max_scn() == snapshot_version) {
     // do not compact row when merging
+  } else if (ObTimeUtility::current_time() < latest_compact_ts + WEAK_READ_COMPACT_THRESHOLD
+             && row.get_uncompacted_node_cnt() < ObMvccRow::HOT_ROW_COMPACT_NODE_CNT) {
+    // the row is compacted recently and the readers only walk a short chain
   } else {
     ObRowLatchGuard guard(row.latch_);
     if (OB_FAIL(row.row_compact(memtable_,
@@ -126,15 +128,17 @@ int ObMvccEngine::get(ObMvccAccessCtx &ctx,
       // rewrite ret
       ret = OB_SUCCESS;
     }
-  } else if (!query_flag.is_prewarm() && value->need_compact(for_read, for_replay)) {
-    int tmp_ret = OB_SUCCESS;
-    if (OB_SUCCESS != (tmp_ret = try_compact_row_when_mvcc_read_(ctx.get_snapshot_version(), *value))) {
-      TRANS_LOG(WARN, "fail to try to compact row", K(tmp_ret));
-    }
-  } else if (query_flag.is_for_foreign_key_check()) {
-    ret = ObRowConflictHandler::check_foreign_key_constraint_for_memtable(ctx, value, lock_state);
   } else {
-    // do nothing
+    if (!query_flag.is_prewarm() && value->need_compact(for_read, for_replay)) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = try_compact_row_when_mvcc_read_(ctx.get_snapshot_version(), *value))) {
+        TRANS_LOG(WARN, "fail to try to compact row", K(tmp_ret));
+      }
+    }
+    // the foreign key check must not be skipped even if the row is compacted above
+    if (query_flag.is_for_foreign_key_check()) {
+      ret = ObRowConflictHandler::check_foreign_key_constraint_for_memtable(ctx, value, lock_state);
+    }
   }
   if (OB_SUCC(ret)) {
     if (OB_FAIL(value_iter.init(ctx,
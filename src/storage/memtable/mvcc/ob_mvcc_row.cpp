@@ -421,6 +421,16 @@ int ObMvccRow::unlink_trans_node(const ObMvccTransNode &node)
   return ret;
 }
 
+int64_t ObMvccRow::get_uncompacted_node_cnt() const
+{
+  int64_t cnt = 0;
+  const ObMvccTransNode *head = ATOMIC_LOAD(&list_head_);
+  if (NULL != head) {
+    cnt = static_cast<int64_t>(head->modify_count_) - ATOMIC_LOAD(&last_compact_cnt_);
+  }
+  return cnt;
+}
+
 bool ObMvccRow::need_compact(const bool for_read, const bool for_replay)
 {
   bool bool_ret = false;
@@ -245,6 +245,9 @@ struct ObMvccRow
   //when the number of nodes visited before finding the right insert position exceeds INDEX_TRIGGER_LENGTH,
   //index will be constructed and used
   static const int64_t INDEX_TRIGGER_COUNT = 500;
+  //when the number of nodes above the latest compact node exceeds HOT_ROW_COMPACT_NODE_CNT,
+  //the row is treated as a hot row and read can compact it without waiting for the interval
+  static const int64_t HOT_ROW_COMPACT_NODE_CNT = 64;
 
   // Spin lock that protects row data.
   ObRowLatch latch_;
@@ -371,6 +374,9 @@ struct ObMvccRow
                                     const transaction::ObTransID &tx_id);
   int64_t get_total_trans_node_cnt() const { return total_trans_node_cnt_; }
   int64_t get_last_compact_cnt() const { return last_compact_cnt_; }
+  // number of tx nodes appended after the latest compact node, which bounds the
+  // distance a reader walks before reaching the compacted version
+  int64_t get_uncompacted_node_cnt() const;
   // ===================== ObMvccRow Flag Interface =====================
   OB_INLINE bool is_btree_indexed() const
   {
@@ -444,6 +444,7 @@ ObLink* ObLockWaitMgr::check_timeout()
   ObLink* tail = NULL;
   Node* iter = NULL;
   Node* node2del = NULL;
+  LockWaitQueueHeadChecker head_checker;
   bool need_check_session = false;
   const int64_t MAX_WAIT_TIME_US = 10 * 1000 * 1000;
   DeadlockedSessionArray *deadlocked_session = NULL;
@@ -464,6 +465,10 @@ ObLink* ObLockWaitMgr::check_timeout()
       }
       TRANS_LOG(TRACE, "LOCK_MGR: check", K(*iter));
       uint64_t hash = iter->hash();
+      // a row lock is handed over to the head waiter only, so the other waiters are not lost
+      // even without retry
+      const bool is_queue_head = head_checker.is_queue_head(hash);
+      bool is_retried = false;
       uint64_t last_lock_seq = iter->lock_seq_;
       uint64_t curr_lock_seq = ATOMIC_LOAD(&sequence_[(hash >> 1)% LOCK_BUCKET_COUNT]);
       if (iter->is_timeout() || has_set_stop()) {
@@ -477,6 +482,7 @@ ObLink* ObLockWaitMgr::check_timeout()
         node2del = iter;
         need_check_session = true;
         iter->on_retry_lock(hash);
+        is_retried = true;
         TRANS_LOG(INFO, "standalone task should be waken up", K(*iter), K(curr_lock_seq));
       } else if (iter->get_run_ts() > 0 && ObTimeUtility::current_time() > iter->get_run_ts()) {
         node2del = iter;
@@ -485,6 +491,7 @@ ObLink* ObLockWaitMgr::check_timeout()
         // again, the reuqests waiting on the same row can also be wakup after
         // the request ends
         iter->on_retry_lock(hash);
+        is_retried = true;
         TRANS_LOG(INFO, "current task should be waken up cause reaching run ts", K(*iter));
       } else if (0 == iter->sessid_) {
         // do nothing, may be rpc plan, sessionid is not setted
@@ -512,10 +519,13 @@ ObLink* ObLockWaitMgr::check_timeout()
           // session is killed, just pop the request
           node2del = iter;
           TRANS_LOG(INFO, "session is killed, pop the request",  "sessid", iter->sessid_, K(*iter), K(tmp_ret));
-        } else if (NULL == node2del && curr_ts - iter->lock_ts_ > MAX_WAIT_TIME_US/2) {
-          // in order to prevent missing to wakeup request, so we force to wakeup every 5s
+        } else if (NULL == node2del && is_queue_head && curr_ts - iter->lock_ts_ > MAX_WAIT_TIME_US/2) {
+          // in order to prevent missing to wakeup request, so we force to wakeup every 5s.
+          // Only the head waiter of a row is forced, waking the whole queue of a hot row makes
+          // all the blocked statements retry and wait again
           node2del = iter;
           iter->on_retry_lock(hash);
+          is_retried = true;
           TRANS_LOG_RET(WARN, OB_ERR_TOO_MUCH_TIME, "LOCK_MGR: req wait lock cost too much time", K(curr_lock_seq), K(last_lock_seq), K(*iter));
         } else {
           transaction::ObTxDesc *&tx_desc = session_info->get_tx_desc();
@@ -533,6 +543,7 @@ ObLink* ObLockWaitMgr::check_timeout()
           TRANS_LOG(INFO, "check transaction state", KP(tx_desc));
         }
       }
+      head_checker.on_checked(hash, node2del == iter ? is_retried : 0 != iter->sessid_);
     }
     if (NULL != node2del) {
       retire_node(tail, node2del);
@@ -399,6 +399,31 @@ public:
   bool is_table_lock_hash(const uint64_t hash) { return (hash & ~HASH_MASK) == TABLE_LOCK_FLAG; }
 };
 
+// Finds the head waiter of every row hash while check_timeout walks the hash. Waiters on
+// the same hash are sorted by their receive time, and the head is the first of them that
+// either keeps waiting on a session or is popped to retry the lock. Waiters without a
+// session and waiters popped to fail (timeout, killed, deadlocked) never take the row, so
+// the ones behind them are checked as the head instead.
+class LockWaitQueueHeadChecker {
+public:
+  LockWaitQueueHeadChecker() : head_hash_(0), has_head_(false) {}
+  // the waiters on a transaction or a table lock are always woken up together
+  bool is_queue_head(const uint64_t hash) const
+  {
+    return !LockHashHelper::is_rowkey_hash(hash) || !has_head_ || head_hash_ != hash;
+  }
+  void on_checked(const uint64_t hash, const bool can_take_lock)
+  {
+    if (can_take_lock && is_queue_head(hash)) {
+      head_hash_ = hash;
+      has_head_ = true;
+    }
+  }
+private:
+  uint64_t head_hash_;
+  bool has_head_;
+};
+
 }; // end namespace memtable
 }; // end namespace oceanbase
 
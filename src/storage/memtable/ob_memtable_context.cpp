@@ -12,6 +12,7 @@
 
 #include "storage/memtable/ob_memtable_context.h"
 #include "lib/ob_errno.h"
+#include "lib/stat/ob_diagnose_info.h"
 #include "storage/ls/ob_ls_tx_service.h"
 #include "storage/memtable/ob_memtable_iterator.h"
 #include "storage/memtable/ob_memtable_data.h"
@@ -515,8 +516,22 @@ int ObMemtableCtx::do_trans_end(
   if (OB_SUCCESS == ATOMIC_LOAD(&end_code_)) {
     ATOMIC_STORE(&end_code_, end_code);
     set_commit_version(trans_version);
+    const int64_t start_ts = common::ObClockGenerator::getClock();
+    const int64_t remove_cnt_before = trans_mgr_.get_callback_remove_for_trans_end_count();
     if (OB_FAIL(trans_mgr_.trans_end(commit))) {
       TRANS_LOG(WARN, "trans end error", K(ret), K(*this));
+    } else {
+      // the callbacks removed by fast commit have been cleaned out before trans end
+      const int64_t remove_cnt =
+        trans_mgr_.get_callback_remove_for_trans_end_count() - remove_cnt_before;
+      const int64_t elapsed = common::ObClockGenerator::getClock() - start_ts;
+      EVENT_ADD(MEMSTORE_TRANS_END_CLEANOUT_COUNT, remove_cnt);
+      EVENT_ADD(MEMSTORE_TRANS_END_TIME, elapsed);
+      if (OB_UNLIKELY(elapsed > SLOW_TRANS_END_THRESHOLD)) {
+        TRANS_LOG(INFO, "memtable handle slow trans end", K(commit), K(remove_cnt), K(elapsed),
+                  "fast_commit_remove_cnt", trans_mgr_.get_callback_remove_for_fast_commit_count(),
+                  KPC(this));
+      }
     }
     // after a transaction finishes, callback memory should be released
     // and check memory leakage
@@ -324,6 +324,8 @@ class ObMemtableCtx : public ObIMemtableCtx
   using RDLockGuard = common::SpinRLockGuard;
   static const int64_t SLOW_QUERY_THRESHOULD = 500 * 1000;
   static const int64_t LOG_CONFLICT_INTERVAL = 3 * 1000 * 1000;
+  // trans end which costs more than this time will be printed with its callback count
+  static const int64_t SLOW_TRANS_END_THRESHOLD = 10 * 1000;
   static const int64_t MAX_RESERVED_CONFLICT_TX_NUM = 30;
 public:
   ObMemtableCtx();
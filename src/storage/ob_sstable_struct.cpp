@@ -131,6 +131,7 @@ ObSSTableMergeInfo::ObSSTableMergeInfo()
       multiplexed_macro_block_count_(0),
       new_micro_count_in_new_macro_(0),
       multiplexed_micro_count_in_new_macro_(0),
+      multiplexed_micro_size_in_new_macro_(0),
       total_row_count_(0),
       incremental_row_count_(0),
       new_flush_data_rate_(0),
@@ -179,6 +180,7 @@ int ObSSTableMergeInfo::add(const ObSSTableMergeInfo &other)
   total_row_count_ += other.total_row_count_;
   incremental_row_count_ += other.incremental_row_count_;
   multiplexed_micro_count_in_new_macro_ += other.multiplexed_micro_count_in_new_macro_;
+  multiplexed_micro_size_in_new_macro_ += other.multiplexed_micro_size_in_new_macro_;
   new_micro_count_in_new_macro_ += other.new_micro_count_in_new_macro_;
 
   if (1 == concurrent_cnt_) {
@@ -211,6 +213,7 @@ void ObSSTableMergeInfo::reset()
   multiplexed_macro_block_count_ = 0;
   new_micro_count_in_new_macro_ = 0;
   multiplexed_micro_count_in_new_macro_ = 0;
+  multiplexed_micro_size_in_new_macro_ = 0;
   total_row_count_ = 0;
   incremental_row_count_ = 0;
   new_flush_data_rate_ = 0;
@@ -254,6 +257,11 @@ int ObSSTableMergeInfo::fill_comment(char *buf, const int64_t buf_len, const cha
   int ret = OB_SUCCESS;
   compaction::ADD_COMPACTION_INFO_PARAM(buf, buf_len,
         "comment", comment_);
+  if (0 != multiplexed_micro_size_in_new_macro_) {
+    compaction::ADD_COMPACTION_INFO_PARAM(buf, buf_len,
+        "reuse_micro_size", multiplexed_micro_size_in_new_macro_,
+        "rewrite_micro_size", compressed_size_);
+  }
   if (0 != suspect_add_time_) {
     compaction::ObIDiagnoseInfoMgr::add_compaction_info_param(buf, buf_len, "[suspect info=");
     compaction::ObIDiagnoseInfoMgr::add_compaction_info_param(buf, buf_len, other_info);
@@ -301,6 +309,7 @@ void ObSSTableMergeInfo::shallow_copy(ObIDiagnoseInfo *other)
     multiplexed_macro_block_count_ = info->multiplexed_macro_block_count_;
     new_micro_count_in_new_macro_ = info->new_micro_count_in_new_macro_;
     multiplexed_micro_count_in_new_macro_ = info->multiplexed_micro_count_in_new_macro_;
+    multiplexed_micro_size_in_new_macro_ = info->multiplexed_micro_size_in_new_macro_;
     total_row_count_ = info->total_row_count_;
     incremental_row_count_ = info->incremental_row_count_;
     new_flush_data_rate_ = info->new_flush_data_rate_;
@@ -123,6 +123,7 @@ public:
                K_(merge_start_time), K_(merge_finish_time), K_(dag_id), K_(occupy_size), K_(new_flush_occupy_size), K_(original_size),
                K_(compressed_size), K_(macro_block_count), K_(multiplexed_macro_block_count),
                K_(new_micro_count_in_new_macro), K_(multiplexed_micro_count_in_new_macro),
+               K_(multiplexed_micro_size_in_new_macro),
                K_(total_row_count), K_(incremental_row_count), K_(new_flush_data_rate),
                K_(is_full_merge), K_(progressive_merge_round), K_(progressive_merge_num),
                K_(concurrent_cnt), K_(start_cg_idx), K_(end_cg_idx), K_(suspect_add_time),
@@ -152,6 +153,7 @@ public:
   int64_t multiplexed_macro_block_count_;
   int64_t new_micro_count_in_new_macro_;
   int64_t multiplexed_micro_count_in_new_macro_;
+  int64_t multiplexed_micro_size_in_new_macro_; // bytes of reused micro blocks, compressed_size_ is the rewritten bytes
   int64_t total_row_count_;
   int64_t incremental_row_count_;
   int64_t new_flush_data_rate_;
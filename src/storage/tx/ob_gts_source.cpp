@@ -35,6 +35,7 @@ void ObGtsStatistics::reset()
   tenant_id_ = 0;
   last_stat_ts_ = 0;
   gts_rpc_cnt_ = 0;
+  coalesced_gts_rpc_cnt_ = 0;
   get_gts_cache_cnt_ = 0;
   get_gts_with_stc_cnt_ = 0;
   try_get_gts_cache_cnt_ = 0;
@@ -62,6 +63,7 @@ void ObGtsStatistics::statistics()
       TRANS_LOG(INFO, "gts statistics",
                       K_(tenant_id),
                       "gts_rpc_cnt", ATOMIC_LOAD(&gts_rpc_cnt_),
+                      "coalesced_gts_rpc_cnt", ATOMIC_LOAD(&coalesced_gts_rpc_cnt_),
                       "get_gts_cache_cnt", ATOMIC_LOAD(&get_gts_cache_cnt_),
                       "get_gts_with_stc_cnt", ATOMIC_LOAD(&get_gts_with_stc_cnt_),
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
@@ -69,6 +71,7 @@ void ObGtsStatistics::statistics()
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
                       "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
+      ATOMIC_STORE(&coalesced_gts_rpc_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&try_get_gts_cache_cnt_, 0);
@@ -177,6 +180,9 @@ int ObGtsSource::get_gts(ObTsCbTask *task, int64_t &gts)
       TRANS_LOG(ERROR, "gts task push error", "ret", tmp_ret, KP(task));
       //overwrite retcode
       ret = tmp_ret;
+    } else if (!need_query_gts_()) {
+      // the task will be handled by the response of the request on the road
+      gts_statistics_.inc_coalesced_gts_rpc_cnt();
     } else {
       const bool need_refresh_gts_location = false;
       if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
@@ -433,7 +439,11 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts, ObTsCbTask *task, bool &need_
       } else {
         TRANS_LOG(INFO, "wait queue push task success", KP(task));
       }
-      if (OB_SUCCESS == ret) {
+      if (OB_SUCCESS != ret) {
+      } else if (!need_query_gts_()) {
+        // the task will be handled by the response of the request on the road
+        gts_statistics_.inc_coalesced_gts_rpc_cnt();
+      } else {
         // ignore error code
         const bool need_refresh_gts_location = false;
         if (OB_SUCCESS != (tmp_ret = refresh_gts_(need_refresh_gts_location))) {
@@ -572,6 +582,16 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
   return ret;
 }
 
+// The tasks in queue are checked again in handle_gts_result when the response of an outstanding
+// request arrives, and a new request is sent there if some tasks still need a larger gts. So the
+// waiting tasks share one outstanding request unless it seems to be lost.
+bool ObGtsSource::need_query_gts_() const
+{
+  return gts_local_cache_.no_rpc_on_road()
+         || MonotonicTs::current_time() - gts_local_cache_.get_latest_srr()
+            > MonotonicTs(GTS_RPC_ON_ROAD_TIMEOUT_US);
+}
+
 int ObGtsSource::refresh_gts_location_()
 {
   int ret = OB_SUCCESS;
@@ -51,11 +51,13 @@ public:
   void inc_try_get_gts_with_stc_cnt() { ATOMIC_INC(&try_get_gts_with_stc_cnt_); }
   void inc_wait_gts_elapse_cnt() { ATOMIC_INC(&wait_gts_elapse_cnt_); }
   void inc_try_wait_gts_elapse_cnt() { ATOMIC_INC(&try_wait_gts_elapse_cnt_); }
+  void inc_coalesced_gts_rpc_cnt() { ATOMIC_INC(&coalesced_gts_rpc_cnt_); }
   void statistics();
 private:
   uint64_t tenant_id_;
   int64_t last_stat_ts_;
   int64_t gts_rpc_cnt_;
+  int64_t coalesced_gts_rpc_cnt_;
 
   int64_t get_gts_cache_cnt_;
   int64_t get_gts_with_stc_cnt_;
@@ -98,6 +100,7 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  bool need_query_gts_() const;
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
@@ -109,6 +112,8 @@ public:
   static const int64_t WAIT_GTS_QUEUE_COUNT = 1;
   static const int64_t WAIT_GTS_QUEUE_START_INDEX = GET_GTS_QUEUE_COUNT;
   static const int64_t TOTAL_GTS_QUEUE_COUNT = GET_GTS_QUEUE_COUNT + WAIT_GTS_QUEUE_COUNT;
+  // a gts request not responded within this time is considered lost, and a new one can be sent
+  static const int64_t GTS_RPC_ON_ROAD_TIMEOUT_US = 10 * 1000;
 private:
   bool is_inited_;
   int64_t tenant_id_;
@@ -41,7 +41,11 @@ public:
     write_seq_no_(),
     submit_cb_list_idx_(-1),
     submit_out_cnt_(0),
-    submitted_scn_()
+    submitted_scn_(),
+    fill_cnt_(0),
+    fill_time_(0),
+    start_ts_(0),
+    last_progress_ts_(0)
   {}
   ~ObTxRedoSubmitter();
   int submit_for_freeze(const uint32_t freeze_clock = UINT32_MAX, const bool display_blocked_info = true) {
@@ -78,6 +82,7 @@ private:
   int fill_log_block_(memtable::ObTxFillRedoCtx &ctx);
   int submit_log_block_out_(const int64_t replay_hint, bool &submitted);
   int after_submit_redo_out_();
+  void print_progress_(const memtable::ObTxFillRedoCtx &ctx);
 public:
   TO_STRING_KV(K_(tx_id),
                K_(ls_id),
@@ -88,7 +93,9 @@ public:
                K_(serial_final),
                K_(submit_if_not_full),
                K_(submit_out_cnt),
-               K_(submit_cb_list_idx));
+               K_(submit_cb_list_idx),
+               K_(fill_cnt),
+               K_(fill_time));
 private:
   ObPartTransCtx &tx_ctx_;
   memtable::ObMemtableCtx &mt_ctx_;
@@ -116,6 +123,13 @@ private:
   int submit_out_cnt_;
   // last submitted log scn
   share::SCN submitted_scn_;
+  // the count of callbacks filled and time used to fill, for progress display
+  int64_t fill_cnt_;
+  int64_t fill_time_;
+  int64_t start_ts_;
+  int64_t last_progress_ts_;
+  // flush of a large txn may take a long time, print its progress in this interval
+  static const int64_t PRINT_PROGRESS_INTERVAL = 1_s;
 };
 
 #define FLUSH_REDO_TRACE_LEVEL DEBUG
@@ -238,6 +252,7 @@ int ObTxRedoSubmitter::_submit_redo_pipeline_(const bool display_blocked_info)
   const bool is_parallel_logging = tx_ctx_.is_parallel_logging();
   bool stop = false;
   int fill_ret = OB_SUCCESS;
+  start_ts_ = last_progress_ts_ = ObTimeUtility::fast_current_time();
   while (OB_SUCC(ret) && !stop) {
     if (submit_if_not_full_ && OB_FAIL(prepare_())) {
       if (OB_TX_NOLOGCB != ret) {
@@ -336,6 +351,9 @@ int ObTxRedoSubmitter::_submit_redo_pipeline_(const bool display_blocked_info)
           ret = submit_ret;
         }
       }
+      if (!stop && flush_all_) {
+        print_progress_(ctx);
+      }
     }
   }
   if (OB_UNLIKELY(display_blocked_info) && fill_ret == OB_BLOCK_FROZEN) {
@@ -383,6 +401,18 @@ int ObTxRedoSubmitter::after_submit_redo_out_()
   return ret;
 }
 
+void ObTxRedoSubmitter::print_progress_(const memtable::ObTxFillRedoCtx &ctx)
+{
+  const int64_t now = ObTimeUtility::fast_current_time();
+  if (now - last_progress_ts_ >= PRINT_PROGRESS_INTERVAL) {
+    last_progress_ts_ = now;
+    TRANS_LOG(INFO, "[REDO FLUSH] submit redo in progress", KPC(this),
+              "cost_time", now - start_ts_,
+              "list_idx", ctx.list_idx_,
+              "pending_log_size", mt_ctx_.get_pending_log_size());
+  }
+}
+
 // allocate/reserve resource for `after_submit_log_out_`
 int ObTxRedoSubmitter::prepare_()
 {
@@ -418,6 +448,8 @@ int ObTxRedoSubmitter::fill_log_block_(memtable::ObTxFillRedoCtx &ctx)
     int64_t start_ts = ObTimeUtility::fast_current_time();
     ret = mt_ctx_.fill_redo_log(ctx);
     ctx.fill_time_ = ObTimeUtility::fast_current_time() - start_ts;
+    fill_cnt_ += MAX(ctx.fill_count_, 0);
+    fill_time_ += ctx.fill_time_;
     int save_ret = ret;
     int64_t real_buf_pos = ctx.fill_count_ > 0 ? ctx.buf_pos_ : 0;
     if (OB_FAIL(log_block_->finish_mutator_buf(log, real_buf_pos))) {
@@ -327,9 +327,15 @@ int ObTxDataMemtableMgr::calc_new_memtable_buckets_cnt_(const double load_factor
   int64_t buckets_size_limit = remain_memory >> 4; /* remain_memory * (1/16) */
 
   int64_t expect_buckets_cnt = old_buckets_cnt;
-  if (load_factory > ObTxDataHashMap::LOAD_FACTORY_MAX_LIMIT &&
-      expect_buckets_cnt < ObTxDataHashMap::MAX_BUCKETS_CNT) {
-    expect_buckets_cnt <<= 1;
+  double expect_load_factory = load_factory;
+  if (load_factory > ObTxDataHashMap::LOAD_FACTORY_MAX_LIMIT) {
+    // grow to the expected size at once instead of doubling once per freeze, or a busy log
+    // stream walks long bucket chains for several freeze rounds until the buckets catch up
+    while (expect_load_factory > ObTxDataHashMap::LOAD_FACTORY_MAX_LIMIT &&
+           expect_buckets_cnt < ObTxDataHashMap::MAX_BUCKETS_CNT) {
+      expect_buckets_cnt <<= 1;
+      expect_load_factory /= 2;
+    }
   } else if (load_factory < ObTxDataHashMap::LOAD_FACTORY_MIN_LIMIT &&
              expect_buckets_cnt > ObTxDataHashMap::MIN_BUCKETS_CNT) {
     expect_buckets_cnt >>= 1;
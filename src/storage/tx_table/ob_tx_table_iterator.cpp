@@ -458,12 +458,14 @@ int ObTxDataSingleRowGetter::get_next_row_(const ObSSTableArray &sstables, ObTxD
   if (OB_SUCC(ret)) {
     ObStringHolder temp_buffer;
     int64_t total_need_buffer_cnt = 0;
+    int64_t sstable_idx = sstables.count() - 1;
     if (OB_FAIL(get_row_from_sstables_(row_key,
                                        sstables,
                                        iter_param_,
                                        access_context,
                                        temp_buffer,
-                                       total_need_buffer_cnt))) {
+                                       total_need_buffer_cnt,
+                                       sstable_idx))) {
       if (OB_ITER_END == ret) {
         STORAGE_LOG(WARN, "tx data not found in sstables", KR(ret), K(tx_id_), K(sstables));
       } else {
@@ -475,8 +477,12 @@ int ObTxDataSingleRowGetter::get_next_row_(const ObSSTableArray &sstables, ObTxD
       STORAGE_LOG(WARN, "push element to reserved array should not fail", KR(ret));
     } else {
       int64_t total_need_buffer_cnt2 = 0;
+      // the rows of one tx data are dumped together, so the remaining rows are searched only in
+      // the sstable where the first row is found
+      const int64_t first_row_sstable_idx = sstable_idx;
       for (int64_t idx = 1; idx < total_need_buffer_cnt && OB_SUCC(ret); ++idx) {
         key_datums_[1].set_int(idx);
+        sstable_idx = first_row_sstable_idx;
         if (OB_FAIL(row_key.assign(key_datums_, 2))) {
           STORAGE_LOG(WARN, "assign row key failed", KR(ret));
         } else if (OB_FAIL(get_row_from_sstables_(row_key,
@@ -484,7 +490,8 @@ int ObTxDataSingleRowGetter::get_next_row_(const ObSSTableArray &sstables, ObTxD
                                                   iter_param_,
                                                   access_context,
                                                   temp_buffer,
-                                                  total_need_buffer_cnt2))) {
+                                                  total_need_buffer_cnt2,
+                                                  sstable_idx))) {
           STORAGE_LOG(WARN, "get row from sstable failed",
                             KR(ret), K(idx), K_(tx_id), K(total_need_buffer_cnt));
         } else if (OB_FAIL(tx_data_buffers_.push_back(std::move(temp_buffer)))) {
@@ -512,7 +519,8 @@ int ObTxDataSingleRowGetter::get_row_from_sstables_(blocksstable::ObDatumRowkey
                                                     const ObTableIterParam &iter_param,
                                                     ObTableAccessContext &access_context,
                                                     ObStringHolder &temp_buffer,
-                                                    int64_t &total_need_buffer_cnt)
+                                                    int64_t &total_need_buffer_cnt,
+                                                    int64_t &sstable_idx)
 {
   int ret = OB_SUCCESS;
 
@@ -521,7 +529,9 @@ int ObTxDataSingleRowGetter::get_row_from_sstables_(blocksstable::ObDatumRowkey
   int tmp_ret = OB_SUCCESS;
   bool find = false;
   const blocksstable::ObDatumRow *row = nullptr;
-  for (int i = sstables.count() - 1; OB_SUCC(ret) && !find && i >= 0; i--) {
+  // search from sstable_idx to the older sstables, sstable_idx is set to where the row is found
+  int64_t i = MIN(sstable_idx, sstables.count() - 1);
+  for (; OB_SUCC(ret) && !find && i >= 0; i--) {
     ObStorageMetaHandle sstable_handle;
     if (OB_ISNULL(table = sstables[i])) {
       ret = OB_ERR_SYS;
@@ -547,6 +557,7 @@ int ObTxDataSingleRowGetter::get_row_from_sstables_(blocksstable::ObDatumRowkey
                          K(row->storage_datums_[TX_DATA_ID_COLUMN].get_int()), K(tx_id_));
     } else {
       find = true;
+      sstable_idx = i;
       total_need_buffer_cnt = row->storage_datums_[TX_DATA_TOTAL_ROW_CNT_COLUMN].get_int();
       if (OB_FAIL(temp_buffer.assign(row->storage_datums_[TX_DATA_VAL_COLUMN].get_string()))) {
         STORAGE_LOG(WARN, "Failed to copy buffer", KR(ret), KPC(table));
@@ -572,12 +583,16 @@ int ObTxDataSingleRowGetter::deserialize_tx_data_from_store_buffers_(ObTxData &t
   int64_t total_buffer_size = 0;
   int64_t pos = 0;
   char *merge_buffer = nullptr;
+  const char *data_buffer = nullptr;
   for (int64_t idx = 0; idx < tx_data_buffers_.count(); ++idx) {
     total_buffer_size += tx_data_buffers_[idx].get_ob_string().length();
   }
   if (total_buffer_size <= 0) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(ERROR, "unexpected buffer size", KR(ret), K(total_buffer_size));
+  } else if (1 == tx_data_buffers_.count()) {
+    // most tx data is stored in one row, deserialize it from the row buffer directly
+    data_buffer = tx_data_buffers_[0].get_ob_string().ptr();
   } else if (nullptr == (merge_buffer = (char*)DEFAULT_TX_DATA_ALLOCATOR.
                                                alloc(total_buffer_size))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -591,11 +606,14 @@ int ObTxDataSingleRowGetter::deserialize_tx_data_from_store_buffers_(ObTxData &t
              tx_data_buffers_[idx].get_ob_string().length());
       p_dest += tx_data_buffers_[idx].get_ob_string().length();
     }
+    data_buffer = merge_buffer;
+  }
+  if (OB_SUCC(ret)) {
     tx_data.tx_id_ = tx_id_;
-    if (OB_FAIL(tx_data.deserialize(merge_buffer, total_buffer_size, pos, tx_data_allocator_))) {
+    if (OB_FAIL(tx_data.deserialize(data_buffer, total_buffer_size, pos, tx_data_allocator_))) {
       STORAGE_LOG(WARN, "deserialize tx data failed",
-                        KR(ret), KPHEX(merge_buffer, total_buffer_size));
-      hex_dump(merge_buffer, total_buffer_size, true, OB_LOG_LEVEL_WARN);
+                        KR(ret), KPHEX(data_buffer, total_buffer_size));
+      hex_dump(data_buffer, total_buffer_size, true, OB_LOG_LEVEL_WARN);
     } else if (!tx_data.is_valid_in_tx_data_table()) {
       ret = OB_INVALID_ARGUMENT;
       STORAGE_LOG(WARN, "the deserialized tx data is invalid.", KR(ret), K(tx_data));
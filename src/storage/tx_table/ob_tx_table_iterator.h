@@ -197,7 +197,8 @@ private:
                              const ObTableIterParam &iter_param,
                              ObTableAccessContext &access_context,
                              ObStringHolder &temp_buffer,
-                             int64_t &total_need_buffer_cnt);
+                             int64_t &total_need_buffer_cnt,
+                             int64_t &sstable_idx);
   OB_NOINLINE int deserialize_tx_data_from_store_buffers_(ObTxData &tx_data);
 
 private:
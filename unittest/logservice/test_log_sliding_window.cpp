@@ -1066,6 +1066,35 @@ TEST_F(TestLogSlidingWindow, test_group_entry_truncate)
   EXPECT_EQ(OB_SUCCESS, group_header.truncate(data_buf_ + group_header_size, log_entry_size, truncate_scn, pre_accum_checksum));
 }
 
+TEST_F(TestLogSlidingWindow, test_switch_freeze_mode)
+{
+  PalfBaseInfo base_info;
+  gen_default_palf_base_info_(base_info);
+  EXPECT_EQ(OB_SUCCESS, log_sw_.init(palf_id_, self_, &mock_state_mgr_,
+        &mock_mm_, &mock_mode_mgr_, &mock_log_engine_, &palf_fs_cb_, alloc_mgr_, plugins_, base_info, true));
+  EXPECT_FALSE(log_sw_.is_in_period_freeze_mode());
+  // heavy load switches to period freeze mode
+  log_sw_.append_cnt_array_[0] = LogSlidingWindow::APPEND_CNT_LB_FOR_PERIOD_FREEZE;
+  EXPECT_EQ(OB_SUCCESS, log_sw_.check_and_switch_freeze_mode());
+  EXPECT_TRUE(log_sw_.is_in_period_freeze_mode());
+  EXPECT_EQ(0, log_sw_.append_cnt_array_[0]);
+  // load slightly below the switch barrier keeps period freeze mode
+  log_sw_.append_cnt_array_[1] = LogSlidingWindow::APPEND_CNT_LB_FOR_PERIOD_FREEZE - 1;
+  EXPECT_EQ(OB_SUCCESS, log_sw_.check_and_switch_freeze_mode());
+  EXPECT_TRUE(log_sw_.is_in_period_freeze_mode());
+  log_sw_.append_cnt_array_[2] = LogSlidingWindow::APPEND_CNT_UB_FOR_FEEDBACK_FREEZE;
+  EXPECT_EQ(OB_SUCCESS, log_sw_.check_and_switch_freeze_mode());
+  EXPECT_TRUE(log_sw_.is_in_period_freeze_mode());
+  // light load switches back to feedback freeze mode
+  log_sw_.append_cnt_array_[3] = LogSlidingWindow::APPEND_CNT_UB_FOR_FEEDBACK_FREEZE - 1;
+  EXPECT_EQ(OB_SUCCESS, log_sw_.check_and_switch_freeze_mode());
+  EXPECT_FALSE(log_sw_.is_in_period_freeze_mode());
+  // load between the two barriers does not switch feedback freeze mode
+  log_sw_.append_cnt_array_[4] = LogSlidingWindow::APPEND_CNT_LB_FOR_PERIOD_FREEZE - 1;
+  EXPECT_EQ(OB_SUCCESS, log_sw_.check_and_switch_freeze_mode());
+  EXPECT_FALSE(log_sw_.is_in_period_freeze_mode());
+}
+
 } // END of unittest
 } // end of oceanbase
 
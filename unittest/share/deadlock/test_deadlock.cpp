@@ -441,6 +441,39 @@ TEST_F(TestObDeadLockDetector, small_cycle_in_big_cycle_bad_case) {
   ASSERT_EQ(true, TestOperation::v_killed_node[1] == 2 || TestOperation::v_killed_node[1] == 5);
 }
 
+// LCL消息的目的地址是本机时，不经过rpc直接投递给本机的detector mgr
+TEST_F(TestObDeadLockDetector, post_lcl_message_to_self) {
+  TestOperation *op = new TestOperation(ObDeadLockTestIntKey(1));
+  ASSERT_EQ(OB_SUCCESS, MTL(ObDeadLockDetectorMgr*)->register_key(ObDeadLockTestIntKey(1), *op, collect_callback, 1));
+  ObLCLNode *node = static_cast<ObLCLNode *>(get_detector_ptr(ObDeadLockTestIntKey(1)));
+  ASSERT_NE(nullptr, node);
+  // no rpc proxy, the message would core dump if it went through rpc
+  ObDeadLockDetectorRpc rpc;
+  rpc.is_inited_ = true;
+  rpc.self_ = GCTX.self_addr();
+  rpc.proxy_ = nullptr;
+
+  UserBinaryKey dest_key;
+  UserBinaryKey src_key;
+  ASSERT_EQ(OB_SUCCESS, dest_key.set_user_key(ObDeadLockTestIntKey(1)));
+  ASSERT_EQ(OB_SUCCESS, src_key.set_user_key(ObDeadLockTestIntKey(2)));
+  ObLCLLabel label(1, ObDetectorPriority(1));
+  label.addr_ = GCTX.self_addr();
+  // lclv is merged in the first half of a LCLP phase, so that the phase does not change
+  int64_t current_ts = ObClockGenerator::getClock();
+  while ((current_ts / PHASE_TIME) % 2 != 0 || current_ts % PHASE_TIME > PHASE_TIME / 2) {
+    std::this_thread::sleep_for(chrono::milliseconds(10));
+    current_ts = ObClockGenerator::getClock();
+  }
+  ObLCLMessage msg;
+  ASSERT_EQ(OB_SUCCESS, msg.set_args(GCTX.self_addr(), dest_key, GCTX.self_addr(), src_key,
+                                     100, label, current_ts));
+  ASSERT_EQ(OB_SUCCESS, rpc.post_lcl_message(GCTX.self_addr(), msg));
+  ASSERT_EQ(101, node->lclv_);
+  ASSERT_EQ(OB_SUCCESS, MTL(ObDeadLockDetectorMgr*)->unregister_key(ObDeadLockTestIntKey(1)));
+  delete op;
+}
+
 // TEST_F(TestObDeadLockDetector, test_lock_conflict_print) {
 //   memtable::RetryInfo retry_info;
 //   while ((ObClockGenerator::getClock() % 1000000) < 100_ms);
@@ -689,6 +689,176 @@ TEST_F(TestCSDecoder, test_decimal_int_decoder)
   ASSERT_EQ(OB_SUCCESS, check_get_row_count(header, micro_block_desc, row_cnt_without_null, col_cnt, false));
 }
 
+TEST_P(TestCSDecoder, test_float_decoder)
+{
+  const bool has_null = std::get<0>(GetParam());
+  const bool is_force_raw = std::get<1>(GetParam());
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 3;
+  ObObjType col_types[col_cnt] = {ObIntType, ObFloatType, ObDoubleType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.column_encodings_[2] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.major_working_cluster_version_ = ObCSEncodingUtil::FLOAT_MIN_DATA_VERSION;
+
+  const int64_t row_cnt = 120;
+  ObMicroBlockCSEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  encoder.is_all_column_force_raw_ = is_force_raw;
+  ObDatumRow row_arr[row_cnt];
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+  }
+  int64_t row_cnt_without_null[col_cnt] = {row_cnt, row_cnt, row_cnt};
+
+  // <1> decimal values with exceptions: nan/inf/-0.0/non-decimal value
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row_arr[i].storage_datums_[0].set_int(i);
+    if (has_null && 0 == i % 10) {
+      row_arr[i].storage_datums_[1].set_null();
+      row_arr[i].storage_datums_[2].set_null();
+      row_cnt_without_null[1]--;
+      row_cnt_without_null[2]--;
+    } else if (i == 1) {
+      row_arr[i].storage_datums_[1].set_float(std::numeric_limits<float>::quiet_NaN());
+      row_arr[i].storage_datums_[2].set_double(std::numeric_limits<double>::quiet_NaN());
+    } else if (i == 3) {
+      row_arr[i].storage_datums_[1].set_float(-std::numeric_limits<float>::infinity());
+      row_arr[i].storage_datums_[2].set_double(std::numeric_limits<double>::infinity());
+    } else if (i == 5) {
+      row_arr[i].storage_datums_[1].set_float(-0.0f);
+      row_arr[i].storage_datums_[2].set_double(-0.0);
+    } else if (i == 7) {
+      row_arr[i].storage_datums_[1].set_float(1.0f / 3);
+      row_arr[i].storage_datums_[2].set_double(1.0 / 3);
+    } else {
+      row_arr[i].storage_datums_[1].set_float(static_cast<float>(i - 60) / 10);
+      row_arr[i].storage_datums_[2].set_double(static_cast<double>(i * 37 - 2000) / 100);
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+  ObMicroBlockDesc micro_block_desc;
+  ObMicroBlockHeader *header = nullptr;
+  ASSERT_EQ(OB_SUCCESS, build_micro_block_desc(encoder, micro_block_desc, header));
+  ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, encoder.encoders_[1]->get_type());
+  ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, encoder.encoders_[2]->get_type());
+  ObFloatColumnEncoder *float_encoder = static_cast<ObFloatColumnEncoder *>(encoder.encoders_[2]);
+  ASSERT_EQ(4, float_encoder->float_meta_.exception_cnt_);
+  ASSERT_EQ(2, float_encoder->float_meta_.exponent_);
+  ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+  ASSERT_EQ(OB_SUCCESS, part_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+  ASSERT_EQ(OB_SUCCESS, check_get_row_count(header, micro_block_desc, row_cnt_without_null, col_cnt, false));
+
+  // <2> all null or all exception
+  encoder.reuse();
+  encoder.is_all_column_force_raw_ = is_force_raw;
+  int64_t row_cnt_without_null_1[col_cnt] = {row_cnt, 0, row_cnt};
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row_arr[i].storage_datums_[0].set_int(i);
+    row_arr[i].storage_datums_[1].set_null();
+    row_arr[i].storage_datums_[2].set_double(std::numeric_limits<double>::quiet_NaN());
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+  ASSERT_EQ(OB_SUCCESS, build_micro_block_desc(encoder, micro_block_desc, header));
+  ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+  ASSERT_EQ(OB_SUCCESS, part_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+  ASSERT_EQ(OB_SUCCESS, check_get_row_count(header, micro_block_desc, row_cnt_without_null_1, col_cnt, false));
+
+  // <3> FLOAT encoding is not written before FLOAT_MIN_DATA_VERSION, neither specified nor chosen
+  ctx_.major_working_cluster_version_ = DATA_VERSION_4_3_1_0;
+  for (int64_t round = 0; round < 2; ++round) {
+    if (1 == round) {
+      ctx_.column_encodings_[1] = ObCSColumnHeader::Type::MAX_TYPE;
+      ctx_.column_encodings_[2] = ObCSColumnHeader::Type::MAX_TYPE;
+    }
+    ObMicroBlockCSEncoder old_encoder;
+    ASSERT_EQ(OB_SUCCESS, old_encoder.init(ctx_));
+    old_encoder.is_all_column_force_raw_ = is_force_raw;
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, old_encoder.append_row(row_arr[i]));
+    }
+    ASSERT_EQ(OB_SUCCESS, build_micro_block_desc(old_encoder, micro_block_desc, header));
+    ASSERT_NE(ObCSColumnHeader::Type::FLOAT, old_encoder.encoders_[1]->get_type());
+    ASSERT_NE(ObCSColumnHeader::Type::FLOAT, old_encoder.encoders_[2]->get_type());
+    ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+  }
+}
+
+TEST_P(TestCSDecoder, test_fsst_string_decoder)
+{
+  const bool has_null = std::get<0>(GetParam());
+  const bool is_force_raw = std::get<1>(GetParam());
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 3;
+  ObObjType col_types[col_cnt] = {ObIntType, ObVarcharType, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::STRING;
+  ctx_.column_encodings_[2] = ObCSColumnHeader::Type::STR_DICT;
+
+  const int64_t data_versions[] = {DATA_VERSION_4_3_1_0, DATA_VERSION_4_3_2_0};
+  for (int64_t v = 0; v < ARRAYSIZEOF(data_versions); ++v) {
+    const int64_t data_version = data_versions[v];
+    const int64_t row_cnt = 120;
+    ObMicroBlockCSEncoder encoder;
+    ctx_.major_working_cluster_version_ = data_version;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    encoder.is_all_column_force_raw_ = is_force_raw;
+    ObDatumRow row_arr[row_cnt];
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+    }
+    int64_t row_cnt_without_null[col_cnt] = {row_cnt, row_cnt, row_cnt};
+
+    // url like strings share many substrings, the dict column has 40 distinct values
+    const int64_t buf_len = 128;
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      row_arr[i].storage_datums_[0].set_int(i);
+      if (has_null && 0 == i % 10) {
+        row_arr[i].storage_datums_[1].set_null();
+        row_arr[i].storage_datums_[2].set_null();
+        row_cnt_without_null[1]--;
+        row_cnt_without_null[2]--;
+      } else {
+        char *url = static_cast<char *>(allocator_.alloc(buf_len));
+        char *category = static_cast<char *>(allocator_.alloc(buf_len));
+        ASSERT_TRUE(nullptr != url && nullptr != category);
+        const int64_t url_len = snprintf(url, buf_len, "https://www.oceanbase.com/docs/%s/page_%ld.html",
+            0 == i % 3 ? "community" : "enterprise", i * 7);
+        const int64_t category_len = snprintf(category, buf_len, "oceanbase_category_%ld_default_value", i % 40);
+        row_arr[i].storage_datums_[1].set_string(url, url_len);
+        row_arr[i].storage_datums_[2].set_string(category, category_len);
+      }
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+    ObMicroBlockDesc micro_block_desc;
+    ObMicroBlockHeader *header = nullptr;
+    ASSERT_EQ(OB_SUCCESS, build_micro_block_desc(encoder, micro_block_desc, header));
+    ASSERT_EQ(ObCSColumnHeader::Type::STRING, encoder.encoders_[1]->get_type());
+    ASSERT_EQ(ObCSColumnHeader::Type::STR_DICT, encoder.encoders_[2]->get_type());
+    const ObStringStreamMeta &str_meta = static_cast<ObStringColumnEncoder *>(encoder.encoders_[1])->enc_ctx_.meta_;
+    const ObStringStreamMeta &dict_meta =
+        static_cast<ObStrDictColumnEncoder *>(encoder.encoders_[2])->string_dict_enc_ctx_.meta_;
+    // fsst is not used before the cluster is upgraded to FSST_MIN_DATA_VERSION
+    const bool expect_fsst = !is_force_raw && data_version >= ObCSEncodingUtil::FSST_MIN_DATA_VERSION;
+    ASSERT_EQ(expect_fsst, str_meta.is_fsst_compressed());
+    ASSERT_EQ(expect_fsst, dict_meta.is_fsst_compressed());
+    const uint8_t expect_version = expect_fsst
+        ? ObStringStreamMeta::OB_STRING_STREAM_META_V2 : ObStringStreamMeta::OB_STRING_STREAM_META_V1;
+    ASSERT_EQ(expect_version, str_meta.version_);
+    ASSERT_EQ(expect_version, dict_meta.version_);
+    if (expect_fsst) {
+      int64_t raw_len = 0;
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        raw_len += row_arr[i].storage_datums_[1].len_;
+      }
+      ASSERT_LT(str_meta.uncompressed_len_ * 4, raw_len * 3);
+    }
+    ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+    ASSERT_EQ(OB_SUCCESS, part_transform_check_row(header, micro_block_desc, row_arr, row_cnt, true));
+    ASSERT_EQ(OB_SUCCESS, check_get_row_count(header, micro_block_desc, row_cnt_without_null, col_cnt, false));
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(TestDecoder, TestCSDecoder, Combine(Bool(), Bool()));
 
 }  // namespace blocksstable
@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_pd_filter_test_base.h"
+#include "storage/blocksstable/cs_encoding/ob_float_column_encoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+class TestFloatPdFilter : public ObPdFilterTestBase
+{
+public:
+  void encode_float_rows(const bool has_null, ObMicroBlockCSEncoder &encoder, ObDatumRow *row_arr);
+  void build_float_filter_ref(const int64_t col_offset, const double *ref_arr,
+                              const int64_t ref_cnt, ObArray<ObObj> &ref_objs);
+  // count the matched rows by comparing the original values, NaN is bigger than any number
+  int64_t count_matched_rows(const int64_t col_offset, const ObWhiteFilterOperatorType op_type,
+                             const double *ref_arr, const int64_t ref_cnt, const ObDatumRow *row_arr);
+
+  static const int64_t ROW_CNT = 120;
+  static const int64_t COL_CNT = 3;
+};
+
+void TestFloatPdFilter::encode_float_rows(const bool has_null, ObMicroBlockCSEncoder &encoder, ObDatumRow *row_arr)
+{
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, COL_CNT));
+    row_arr[i].storage_datums_[0].set_int(i);
+    if (has_null && 0 == i % 10) {
+      row_arr[i].storage_datums_[1].set_null();
+      row_arr[i].storage_datums_[2].set_null();
+    } else if (1 == i) {
+      row_arr[i].storage_datums_[1].set_float(std::numeric_limits<float>::quiet_NaN());
+      row_arr[i].storage_datums_[2].set_double(std::numeric_limits<double>::quiet_NaN());
+    } else if (3 == i) {
+      row_arr[i].storage_datums_[1].set_float(std::numeric_limits<float>::infinity());
+      row_arr[i].storage_datums_[2].set_double(std::numeric_limits<double>::infinity());
+    } else if (5 == i) {
+      row_arr[i].storage_datums_[1].set_float(-0.0f);
+      row_arr[i].storage_datums_[2].set_double(-0.0);
+    } else if (7 == i) {
+      row_arr[i].storage_datums_[1].set_float(1.0f / 3);
+      row_arr[i].storage_datums_[2].set_double(1.0 / 3);
+    } else if (9 == i) {
+      row_arr[i].storage_datums_[1].set_float(-std::numeric_limits<float>::infinity());
+      row_arr[i].storage_datums_[2].set_double(-std::numeric_limits<double>::infinity());
+    } else {
+      row_arr[i].storage_datums_[1].set_float(static_cast<float>(i - 60) / 10);
+      row_arr[i].storage_datums_[2].set_double(static_cast<double>(i * 37 - 2000) / 100);
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+}
+
+void TestFloatPdFilter::build_float_filter_ref(const int64_t col_offset, const double *ref_arr,
+                                               const int64_t ref_cnt, ObArray<ObObj> &ref_objs)
+{
+  ObObj ref_obj;
+  ref_objs.reset();
+  for (int64_t i = 0; i < ref_cnt; ++i) {
+    if (ObFloatType == col_descs_.at(col_offset).col_type_.get_type()) {
+      ref_obj.set_float(static_cast<float>(ref_arr[i]));
+    } else {
+      ref_obj.set_double(ref_arr[i]);
+    }
+    ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj));
+  }
+}
+
+int64_t TestFloatPdFilter::count_matched_rows(const int64_t col_offset, const ObWhiteFilterOperatorType op_type,
+    const double *ref_arr, const int64_t ref_cnt, const ObDatumRow *row_arr)
+{
+  const bool is_float = ObFloatType == col_descs_.at(col_offset).col_type_.get_type();
+  auto cmp = [] (const double l, const double r)
+  {
+    return std::isnan(l) ? (std::isnan(r) ? 0 : 1) : (std::isnan(r) ? -1 : (l == r ? 0 : (l < r ? -1 : 1)));
+  };
+  double refs[ref_cnt];
+  for (int64_t i = 0; i < ref_cnt; ++i) {
+    refs[i] = is_float ? static_cast<float>(ref_arr[i]) : ref_arr[i];
+  }
+  int64_t matched_cnt = 0;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    const ObStorageDatum &datum = row_arr[i].storage_datums_[col_offset];
+    if (datum.is_null()) {
+      continue;
+    }
+    const double v = is_float ? datum.get_float() : datum.get_double();
+    bool is_match = false;
+    switch (op_type) {
+      case WHITE_OP_EQ: is_match = 0 == cmp(v, refs[0]); break;
+      case WHITE_OP_NE: is_match = 0 != cmp(v, refs[0]); break;
+      case WHITE_OP_GT: is_match = cmp(v, refs[0]) > 0; break;
+      case WHITE_OP_GE: is_match = cmp(v, refs[0]) >= 0; break;
+      case WHITE_OP_LT: is_match = cmp(v, refs[0]) < 0; break;
+      case WHITE_OP_LE: is_match = cmp(v, refs[0]) <= 0; break;
+      case WHITE_OP_BT: is_match = cmp(v, refs[0]) >= 0 && cmp(v, refs[1]) <= 0; break;
+      case WHITE_OP_IN: {
+        for (int64_t j = 0; !is_match && j < ref_cnt; ++j) {
+          is_match = 0 == cmp(v, refs[j]);
+        }
+        break;
+      }
+      default: break;
+    }
+    matched_cnt += is_match;
+  }
+  return matched_cnt;
+}
+
+TEST_F(TestFloatPdFilter, test_float_decoder_filter)
+{
+  const int64_t rowkey_cnt = 1;
+  ObObjType col_types[COL_CNT] = {ObIntType, ObFloatType, ObDoubleType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, COL_CNT));
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.column_encodings_[2] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.major_working_cluster_version_ = ObCSEncodingUtil::FLOAT_MIN_DATA_VERSION;
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  for (int8_t flag = 0; flag <= 1; ++flag) {
+    const bool has_null = flag;
+    const int64_t row_cnt = ROW_CNT;
+    const int64_t null_cnt = has_null ? ROW_CNT / 10 : 0;
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ObDatumRow row_arr[ROW_CNT];
+    encode_float_rows(has_null, encoder, row_arr);
+
+    HANDLE_TRANSFORM();
+
+    ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, encoder.encoders_[1]->get_type());
+    ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, encoder.encoders_[2]->get_type());
+    // nan, inf, -0.0, 1/3 and -inf can't be represented by digits
+    ASSERT_EQ(5, static_cast<ObFloatColumnEncoder *>(encoder.encoders_[2])->float_meta_.exception_cnt_);
+
+    ObArray<ObObj> ref_objs;
+    for (int64_t col_offset = 1; col_offset < COL_CNT; ++col_offset) {
+      const ObObjMeta &col_meta = col_descs_.at(col_offset).col_type_;
+      // check NU/NN, null is stored as a digit, exceptions are never null
+      {
+        ref_objs.reset();
+        ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(WHITE_OP_NU, row_cnt, COL_CNT,
+            col_offset, col_meta, ref_objs, decoder, null_cnt));
+        ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(WHITE_OP_NN, row_cnt, COL_CNT,
+            col_offset, col_meta, ref_objs, decoder, row_cnt - null_cnt));
+      }
+
+      // check EQ/NE/GT/GE/LT/LE on digits, exception rows are checked again on the original values
+      // and the null digit never matches. A nan filter value is compared with datums.
+      {
+        const double ref_arr[] = {0.0, -0.0, 1.5, -1.5, 2.57, -3.05, 100.0, 1.0 / 3, inf, -inf, nan};
+        const ObWhiteFilterOperatorType op_types[] =
+            {WHITE_OP_EQ, WHITE_OP_NE, WHITE_OP_GT, WHITE_OP_GE, WHITE_OP_LT, WHITE_OP_LE};
+        for (int64_t i = 0; i < ARRAYSIZEOF(ref_arr); ++i) {
+          build_float_filter_ref(col_offset, ref_arr + i, 1, ref_objs);
+          for (int64_t j = 0; j < ARRAYSIZEOF(op_types); ++j) {
+            ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(op_types[j], row_cnt, COL_CNT,
+                col_offset, col_meta, ref_objs, decoder,
+                count_matched_rows(col_offset, op_types[j], ref_arr + i, 1, row_arr)))
+                << "col: " << col_offset << " ref: " << ref_arr[i] << " op: " << op_types[j];
+          }
+        }
+      }
+
+      // check BT
+      {
+        const double ref_arr[][2] = {{-1.0, 1.0}, {-1.5, 2.57}, {0.35, 0.35}, {2.0, inf}, {-inf, 0.0},
+                                     {1.0, -1.0}, {0.0, nan}};
+        for (int64_t i = 0; i < ARRAYSIZEOF(ref_arr); ++i) {
+          build_float_filter_ref(col_offset, ref_arr[i], 2, ref_objs);
+          ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(WHITE_OP_BT, row_cnt, COL_CNT,
+              col_offset, col_meta, ref_objs, decoder,
+              count_matched_rows(col_offset, WHITE_OP_BT, ref_arr[i], 2, row_arr)))
+              << "col: " << col_offset << " round: " << i;
+        }
+      }
+
+      // check IN
+      {
+        const double ref_arr[][3] = {{0.0, 1.5, nan}, {-1.5, 2.57, 100.0}, {inf, -inf, 1.0 / 3}};
+        for (int64_t i = 0; i < ARRAYSIZEOF(ref_arr); ++i) {
+          build_float_filter_ref(col_offset, ref_arr[i], 3, ref_objs);
+          ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(WHITE_OP_IN, row_cnt, COL_CNT,
+              col_offset, col_meta, ref_objs, decoder,
+              count_matched_rows(col_offset, WHITE_OP_IN, ref_arr[i], 3, row_arr)))
+              << "col: " << col_offset << " round: " << i;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestFloatPdFilter, test_float_decode_vector)
+{
+  const int64_t rowkey_cnt = 1;
+  ObObjType col_types[COL_CNT] = {ObIntType, ObFloatType, ObDoubleType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, COL_CNT));
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.column_encodings_[2] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.major_working_cluster_version_ = ObCSEncodingUtil::FLOAT_MIN_DATA_VERSION;
+
+  for (int8_t flag = 0; flag <= 1; ++flag) {
+    const bool has_null = flag;
+    const int64_t row_cnt = ROW_CNT;
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ObDatumRow row_arr[ROW_CNT];
+    encode_float_rows(has_null, encoder, row_arr);
+
+    HANDLE_TRANSFORM();
+
+    // decode rows in descending order with a stride, so that null and exception rows are
+    // patched at positions different from their row ids
+    const int64_t step_cnt = 3;
+    int64_t row_ids[ROW_CNT];
+    const char *ptr_arr[ROW_CNT];
+    uint32_t len_arr[ROW_CNT];
+    for (int64_t step = 1; step <= step_cnt; ++step) {
+      int64_t row_cap = 0;
+      for (int64_t row_id = ROW_CNT - 1; row_id >= 0; row_id -= step) {
+        row_ids[row_cap++] = row_id;
+      }
+      for (int64_t col_idx = 1; col_idx < COL_CNT; ++col_idx) {
+        ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, decoder.decoders_[col_idx].decoder_->get_type());
+        ObArenaAllocator frame_allocator;
+        sql::ObExecContext exec_context(allocator_);
+        sql::ObEvalCtx eval_ctx(exec_context);
+        sql::ObExpr col_expr;
+        const ObObjMeta col_meta = col_descs_.at(col_idx).col_type_;
+        ASSERT_EQ(OB_SUCCESS, VectorDecodeTestUtil::generate_column_output_expr(
+            ROW_CNT, col_meta, VEC_FIXED, eval_ctx, col_expr, frame_allocator));
+        ObVectorDecodeCtx vector_ctx(ptr_arr, len_arr, row_ids, row_cap, 0, col_expr.get_vector_header(eval_ctx));
+        ASSERT_EQ(OB_SUCCESS, decoder.get_col_data(col_idx, vector_ctx));
+        for (int64_t i = 0; i < row_cap; ++i) {
+          ASSERT_TRUE(VectorDecodeTestUtil::verify_vector_and_datum_match(
+              *vector_ctx.get_vector(), i, row_arr[row_ids[i]].storage_datums_[col_idx]))
+              << "col: " << col_idx << " row: " << row_ids[i] << " step: " << step;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestFloatPdFilter, test_float_encoding_size_and_decode_perf)
+{
+  // price like values with two decimal places, compare the block size and the vector decode time of
+  // FLOAT encoding with INTEGER encoding on the bit patterns of the doubles
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  const int64_t row_cnt = 4096;
+  const int64_t decode_round = 1000;
+  ObObjType col_types[col_cnt] = {ObIntType, ObDoubleType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt, ObCompressorType::NONE_COMPRESSOR));
+  ctx_.major_working_cluster_version_ = ObCSEncodingUtil::FLOAT_MIN_DATA_VERSION;
+
+  void *row_buf = allocator_.alloc(sizeof(ObDatumRow) * row_cnt);
+  ASSERT_NE(nullptr, row_buf);
+  ObDatumRow *row_arr = new (row_buf) ObDatumRow[row_cnt];
+  uint64_t seed = 20240101;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    row_arr[i].storage_datums_[0].set_int(i);
+    row_arr[i].storage_datums_[1].set_double(static_cast<double>((seed >> 33) % 1000000) / 100);
+  }
+
+  const ObCSColumnHeader::Type types[] = {ObCSColumnHeader::Type::FLOAT, ObCSColumnHeader::Type::INTEGER};
+  int64_t block_sizes[ARRAYSIZEOF(types)] = {0};
+  int64_t row_ids[row_cnt];
+  const char *ptr_arr[row_cnt];
+  uint32_t len_arr[row_cnt];
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row_ids[i] = i;
+  }
+  for (int64_t t = 0; t < ARRAYSIZEOF(types); ++t) {
+    ctx_.column_encodings_[1] = types[t];
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+
+    HANDLE_TRANSFORM();
+
+    ASSERT_EQ(types[t], encoder.encoders_[1]->get_type());
+    ASSERT_EQ(types[t], decoder.decoders_[1].decoder_->get_type());
+    block_sizes[t] = micro_block_desc.buf_size_;
+
+    ObArenaAllocator frame_allocator;
+    sql::ObExecContext exec_context(allocator_);
+    sql::ObEvalCtx eval_ctx(exec_context);
+    sql::ObExpr col_expr;
+    ASSERT_EQ(OB_SUCCESS, VectorDecodeTestUtil::generate_column_output_expr(
+        row_cnt, col_descs_.at(1).col_type_, VEC_FIXED, eval_ctx, col_expr, frame_allocator));
+    ObVectorDecodeCtx vector_ctx(ptr_arr, len_arr, row_ids, row_cnt, 0, col_expr.get_vector_header(eval_ctx));
+    const int64_t start_time = ObTimeUtility::current_time();
+    for (int64_t round = 0; round < decode_round; ++round) {
+      ASSERT_EQ(OB_SUCCESS, decoder.get_col_data(1, vector_ctx));
+    }
+    const int64_t decode_time = ObTimeUtility::current_time() - start_time;
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_TRUE(VectorDecodeTestUtil::verify_vector_and_datum_match(
+          *vector_ctx.get_vector(), i, row_arr[i].storage_datums_[1])) << "type: " << types[t] << " row: " << i;
+    }
+    std::cout << "encoding type: " << types[t]
+              << ", raw double size: " << row_cnt * sizeof(double)
+              << ", micro block size: " << block_sizes[t]
+              << ", decode " << row_cnt * decode_round << " rows in " << decode_time << "us" << std::endl;
+    LOG_INFO("float encoding perf", K(types[t]), K(row_cnt), "block_size", block_sizes[t],
+             K(decode_round), K(decode_time));
+  }
+  // digits of two decimal places need fewer bits than the bit patterns of the doubles
+  ASSERT_LT(block_sizes[0], block_sizes[1]);
+}
+
+}  // namespace blocksstable
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_float_pd_filter.log*");
+  OB_LOGGER.set_file_name("test_float_pd_filter.log", true, false);
+  oceanbase::common::ObLogger::get_logger().set_log_level("DEBUG");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -11,6 +11,8 @@
  */
 
 #include "ob_pd_filter_test_base.h"
+#include "storage/blocksstable/cs_encoding/ob_fsst_codec.h"
+#include "storage/blocksstable/cs_encoding/ob_string_column_decoder.h"
 
 namespace oceanbase
 {
@@ -347,6 +349,126 @@ TEST_F(TestStringPdFilter, test_string_all_null_decoder)
   }
 }
 
+TEST_F(TestStringPdFilter, test_fsst_string_decoder_filter)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  ObObjType col_types[col_cnt] = {ObInt32Type, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ctx_.column_encodings_[0] = ObCSColumnHeader::Type::INTEGER;
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::STRING;
+  ctx_.major_working_cluster_version_ = ObCSEncodingUtil::FSST_MIN_DATA_VERSION;
+  // equal codes means equal bytes only for binary collation, so filter on codes needs varbinary
+  col_descs_.at(1).col_type_.set_collation_type(CS_TYPE_BINARY);
+  read_info_.reset();
+  ASSERT_EQ(OB_SUCCESS, read_info_.init(allocator_, col_cnt, rowkey_cnt, lib::is_oracle_mode(), col_descs_, nullptr));
+
+  for (int8_t flag = 0; flag <= 1; ++flag) {
+    bool has_null = flag;
+    const int64_t null_cnt = has_null ? 20 : 0;
+    const int64_t row_cnt = 100 + null_cnt;
+    const int64_t distinct_cnt = 20;
+
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    ObDatumRow row_arr[row_cnt];
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+    }
+    // url like strings share many substrings, each one appears 5 times
+    const int64_t buf_len = 128;
+    char *url_arr[distinct_cnt + 1];
+    int64_t url_len_arr[distinct_cnt + 1];
+    for (int64_t i = 0; i < distinct_cnt + 1; ++i) {
+      url_arr[i] = static_cast<char *>(allocator_.alloc(buf_len));
+      ASSERT_TRUE(nullptr != url_arr[i]);
+      url_len_arr[i] = snprintf(url_arr[i], buf_len, "https://www.oceanbase.com/docs/%s/page_%ld.html",
+          0 == i % 2 ? "community" : "enterprise", i);
+    }
+    for (int64_t i = 0; i < 100; ++i) {
+      row_arr[i].storage_datums_[0].set_int32(i);
+      row_arr[i].storage_datums_[1].set_string(url_arr[i % distinct_cnt], url_len_arr[i % distinct_cnt]);
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+    for (int64_t i = 100; i < row_cnt; ++i) {
+      row_arr[i].storage_datums_[0].set_int32(i);
+      row_arr[i].storage_datums_[1].set_null();
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+
+    HANDLE_TRANSFORM();
+
+    ASSERT_EQ(ObCSColumnHeader::Type::STRING, encoder.encoders_[1]->get_type());
+    ASSERT_TRUE(static_cast<ObStringColumnEncoder *>(encoder.encoders_[1])->enc_ctx_.meta_.is_fsst_compressed());
+    const int64_t col_offset = 1;
+    ObColumnCSDecoderCtx &col_ctx = *decoder.decoders_[col_offset].ctx_;
+    ObFSSTStringDecoder *fsst_decoder = col_ctx.string_ctx_.fsst_decoder_;
+    ASSERT_TRUE(nullptr != fsst_decoder);
+
+    // {url index, expected count}, index distinct_cnt is a url not in the block
+    std::pair<int64_t, int64_t> eq_arr[4] = {{0, 5}, {7, 5}, {19, 5}, {distinct_cnt, 0}};
+    ObArray<ObObj> ref_objs;
+    ObObj ref_obj;
+    for (int64_t i = 0; i < 4; ++i) {
+      ref_objs.reset();
+      ref_obj.set_varchar(url_arr[eq_arr[i].first], url_len_arr[eq_arr[i].first]);
+      ref_obj.set_collation_type(CS_TYPE_BINARY);
+      ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj));
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(ObWhiteFilterOperatorType::WHITE_OP_EQ, row_cnt,
+          col_cnt, col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, eq_arr[i].second));
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(ObWhiteFilterOperatorType::WHITE_OP_NE, row_cnt,
+          col_cnt, col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, 100 - eq_arr[i].second));
+    }
+    // a prefix of a stored url must not match
+    ref_objs.reset();
+    ref_obj.set_varchar(url_arr[1], url_len_arr[1] - 1);
+    ref_obj.set_collation_type(CS_TYPE_BINARY);
+    ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj));
+    ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(ObWhiteFilterOperatorType::WHITE_OP_EQ, row_cnt,
+        col_cnt, col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, 0));
+
+    // check IN
+    {
+      const int64_t in_arr[4] = {2, 3, 3, distinct_cnt};
+      ref_objs.reset();
+      for (int64_t i = 0; i < 4; ++i) {
+        ref_obj.set_varchar(url_arr[in_arr[i]], url_len_arr[in_arr[i]]);
+        ref_obj.set_collation_type(CS_TYPE_BINARY);
+        ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj));
+      }
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(ObWhiteFilterOperatorType::WHITE_OP_IN, row_cnt,
+          col_cnt, col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, 10));
+    }
+
+    // check NU/NN
+    {
+      ref_objs.reset();
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(ObWhiteFilterOperatorType::WHITE_OP_NU, row_cnt,
+          col_cnt, col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, null_cnt));
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(ObWhiteFilterOperatorType::WHITE_OP_NN, row_cnt,
+          col_cnt, col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, 100));
+    }
+    // all filters above run on the codes without decoding the whole stream
+    ASSERT_FALSE(fsst_decoder->is_materialized());
+
+    // strings decoded one by one stay valid while more rows are decoded, until they take more
+    // memory than the codes and the whole stream is materialized
+    const ObStringColumnDecoder &string_decoder =
+        static_cast<const ObStringColumnDecoder &>(*decoder.decoders_[col_offset].decoder_);
+    ObStorageDatum datums[row_cnt];
+    for (int64_t round = 0; round < 2; ++round) {
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        ASSERT_EQ(OB_SUCCESS, string_decoder.decode(col_ctx, i, datums[i]));
+        ASSERT_LE(fsst_decoder->single_decoded_size_, fsst_decoder->get_code_len_());
+      }
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        ASSERT_TRUE(ObDatum::binary_equal(row_arr[i].storage_datums_[1], datums[i])) << "row: " << i;
+      }
+    }
+    ASSERT_TRUE(fsst_decoder->is_materialized());
+  }
+}
+
 }  // namespace blocksstable
 }  // namespace oceanbase
 
@@ -175,6 +175,51 @@ TEST_F(TestEncoderOverFlow, test_append_row_with_timestamp_and_max_estimate_limi
   ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
 }
 
+TEST_F(TestEncoderOverFlow, test_skip_losing_encoder)
+{
+  ObMicroBlockEncoder encoder;
+  encoder.data_buffer_.allocator_.set_tenant_id(500);
+  encoder.row_buf_holder_.allocator_.set_tenant_id(500);
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+
+  const int64_t column_idx = 1;
+  bool skipped_encoders[ObColumnHeader::MAX_TYPE];
+  for (int64_t micro_block_cnt = 0; micro_block_cnt < 70; ++micro_block_cnt) {
+    encoder.ctx_.micro_block_cnt_ = micro_block_cnt;
+    ObColumnEncodingCtx cc;
+    encoder.mark_skipped_encoders(column_idx, skipped_encoders, cc);
+    // rle loses 8 times in the first 8 micro blocks, then it is only retried in every 32 micro blocks
+    const bool expect_try = micro_block_cnt < ObEncoderLoseStat::SKIP_LOSE_CNT
+        || 0 == micro_block_cnt % ObEncoderLoseStat::RETRY_CYCLE_CNT;
+    ASSERT_EQ(expect_try, !skipped_encoders[ObColumnHeader::RLE]) << "micro_block_cnt: " << micro_block_cnt;
+    ASSERT_EQ(!expect_try, cc.detected_encoders_[ObColumnHeader::RLE]);
+    // dict always wins and is never skipped, const is never tried and never skipped
+    ASSERT_FALSE(skipped_encoders[ObColumnHeader::DICT]);
+    ASSERT_FALSE(skipped_encoders[ObColumnHeader::CONST]);
+    cc.detected_encoders_[ObColumnHeader::DICT] = true;
+    cc.detected_encoders_[ObColumnHeader::RLE] = true;
+    ASSERT_EQ(OB_SUCCESS, encoder.update_encoder_lose_stat(column_idx, ObColumnHeader::DICT, skipped_encoders, cc));
+  }
+  ASSERT_EQ(ObEncoderLoseStat::SKIP_LOSE_CNT + 2,
+      encoder.ctx_.encoder_lose_stats_.at(column_idx).lose_cnts_[ObColumnHeader::RLE]);
+
+  // rle wins in a retry, then it is tried in the following micro blocks again
+  encoder.ctx_.micro_block_cnt_ = 3 * ObEncoderLoseStat::RETRY_CYCLE_CNT;
+  ObColumnEncodingCtx cc;
+  encoder.mark_skipped_encoders(column_idx, skipped_encoders, cc);
+  ASSERT_FALSE(skipped_encoders[ObColumnHeader::RLE]);
+  cc.detected_encoders_[ObColumnHeader::DICT] = true;
+  cc.detected_encoders_[ObColumnHeader::RLE] = true;
+  ASSERT_EQ(OB_SUCCESS, encoder.update_encoder_lose_stat(column_idx, ObColumnHeader::RLE, skipped_encoders, cc));
+  ASSERT_EQ(0, encoder.ctx_.encoder_lose_stats_.at(column_idx).lose_cnts_[ObColumnHeader::RLE]);
+  // dict is always tried and not tracked
+  ASSERT_EQ(0, encoder.ctx_.encoder_lose_stats_.at(column_idx).lose_cnts_[ObColumnHeader::DICT]);
+  encoder.ctx_.micro_block_cnt_++;
+  cc.reset();
+  encoder.mark_skipped_encoders(column_idx, skipped_encoders, cc);
+  ASSERT_FALSE(skipped_encoders[ObColumnHeader::RLE]);
+}
+
 static ObObjType test_dict_large_varchar[2] = {ObIntType, ObVarcharType};
 class TestDictLargeVarchar : public TestIColumnEncoder
 {
@@ -619,6 +619,179 @@ TEST_F(TestIndexBlockAggregator, test_sum)
   }
 }
 
+TEST_F(TestIndexBlockAggregator, bloom_filter_aggregate)
+{
+  static const int64_t test_column_cnt = 2;
+  const int64_t test_row_cnt = 20;
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  ObObjType col_obj_types[test_column_cnt];
+  col_obj_types[0] = ObIntType;
+  col_obj_types[1] = ObVarcharType;
+  init_schema(test_column_cnt, col_obj_types);
+  const int64_t int_col_idx = 0;
+  const int64_t varchar_col_idx = 1 + extra_rowkey_cnt;
+  ObSkipIndexColMeta meta;
+  meta.col_idx_ = int_col_idx;
+  meta.col_type_ = SK_IDX_BLOOM_FILTER;
+  ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(meta));
+  meta.col_idx_ = varchar_col_idx;
+  ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(meta));
+  meta.col_type_ = SK_IDX_NGRAM_BLOOM_FILTER;
+  ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(meta));
+
+  ObSkipIndexAggregator data_aggregator;
+  ObSkipIndexAggregator index_aggregator;
+  ObDatumRow data_agg_result;
+  ObDatumRow index_agg_result;
+  ASSERT_EQ(OB_SUCCESS, data_agg_result.init(full_agg_metas_.count()));
+  ASSERT_EQ(OB_SUCCESS, index_agg_result.init(full_agg_metas_.count()));
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.init(full_agg_metas_, col_descs_, true, data_agg_result, allocator_));
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.init(full_agg_metas_, col_descs_, false, index_agg_result, allocator_));
+
+  ObDatumRow generate_rows[test_row_cnt];
+  const ObDatumRow *data_agg_row = nullptr;
+  const ObDatumRow *index_agg_row = nullptr;
+  for (int64_t i = 0; i < test_row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, generate_rows[i].init(allocator_, full_column_count_));
+    generate_row_by_seed(i, generate_rows[i]);
+    ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(generate_rows[i]));
+    // flush a micro block every 5 rows
+    if (4 == i % 5) {
+      ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+      ASSERT_EQ(full_agg_metas_.count(), data_agg_row->get_column_count());
+      for (int64_t j = 0; j < full_agg_metas_.count(); ++j) {
+        ASSERT_FALSE(data_agg_row->storage_datums_[j].is_nop());
+        ASSERT_TRUE(ObSkipIndexBloomFilter::is_valid_size(data_agg_row->storage_datums_[j].len_));
+      }
+      // no false negative on values of the micro block
+      const ObStorageDatum &int_bloom = data_agg_row->storage_datums_[0];
+      const ObStorageDatum &varchar_bloom = data_agg_row->storage_datums_[1];
+      const ObStorageDatum &ngram_bloom = data_agg_row->storage_datums_[2];
+      for (int64_t k = i - 4; k <= i; ++k) {
+        const ObStorageDatum &int_datum = generate_rows[k].storage_datums_[int_col_idx];
+        const ObStorageDatum &varchar_datum = generate_rows[k].storage_datums_[varchar_col_idx];
+        uint64_t hash = 0;
+        ASSERT_EQ(OB_SUCCESS, ObSkipIndexBloomFilter::calc_hash(col_descs_.at(int_col_idx).col_type_, int_datum, hash));
+        ASSERT_TRUE(ObSkipIndexBloomFilter::may_contain(hash, int_bloom.ptr_, int_bloom.len_));
+        if (!varchar_datum.is_null()) {
+          ASSERT_EQ(OB_SUCCESS, ObSkipIndexBloomFilter::calc_hash(col_descs_.at(varchar_col_idx).col_type_, varchar_datum, hash));
+          ASSERT_TRUE(ObSkipIndexBloomFilter::may_contain(hash, varchar_bloom.ptr_, varchar_bloom.len_));
+          for (int64_t j = 0; j + ObSkipIndexBloomFilter::NGRAM_SIZE <= varchar_datum.len_; ++j) {
+            ASSERT_TRUE(ObSkipIndexBloomFilter::may_contain(
+                ObSkipIndexBloomFilter::calc_ngram_hash(varchar_datum.ptr_ + j), ngram_bloom.ptr_, ngram_bloom.len_));
+          }
+        }
+      }
+      const char *row_buf = nullptr;
+      int64_t row_size = 0;
+      serialize_agg_row(*data_agg_row, row_buf, row_size);
+      ASSERT_EQ(OB_SUCCESS, index_aggregator.eval(row_buf, row_size, 5));
+      data_aggregator.reuse();
+    }
+  }
+  // bloom filter is only kept at micro block level
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.get_aggregated_row(index_agg_row));
+  ASSERT_EQ(full_agg_metas_.count(), index_agg_row->get_column_count());
+  for (int64_t i = 0; i < full_agg_metas_.count(); ++i) {
+    ASSERT_TRUE(index_agg_row->storage_datums_[i].is_nop());
+  }
+
+  // bloom filter of a micro block is not aggregated if any value is out row
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(generate_rows[0]));
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+  ASSERT_FALSE(data_agg_row->storage_datums_[0].is_nop());
+  ObDatumRow outrow_row;
+  ASSERT_EQ(OB_SUCCESS, outrow_row.init(allocator_, full_column_count_));
+  generate_row_by_seed(1, outrow_row);
+  outrow_row.storage_datums_[varchar_col_idx].set_outrow();
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(outrow_row));
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+  ASSERT_FALSE(data_agg_row->storage_datums_[0].is_nop());
+  ASSERT_TRUE(data_agg_row->storage_datums_[1].is_nop());
+  ASSERT_TRUE(data_agg_row->storage_datums_[2].is_nop());
+}
+
+TEST_F(TestIndexBlockAggregator, ngram_bloom_filter_prune_url)
+{
+  // urls clustered by site in micro blocks of about 9KB, as they are when the site is a rowkey prefix
+  static const int64_t test_column_cnt = 2;
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  const int64_t site_cnt = 64;
+  const int64_t rows_per_block = 200;
+  const char *syllables[] = {"ocean", "river", "cloud", "stone", "maple", "delta", "lunar", "pixel"};
+  ObObjType col_obj_types[test_column_cnt];
+  col_obj_types[0] = ObIntType;
+  col_obj_types[1] = ObVarcharType;
+  init_schema(test_column_cnt, col_obj_types);
+  const int64_t varchar_col_idx = 1 + extra_rowkey_cnt;
+  ObSkipIndexColMeta meta;
+  meta.col_idx_ = varchar_col_idx;
+  meta.col_type_ = SK_IDX_NGRAM_BLOOM_FILTER;
+  ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(meta));
+
+  ObSkipIndexAggregator data_aggregator;
+  ObSkipIndexAggregator table_aggregator;
+  ObDatumRow data_agg_result;
+  ObDatumRow table_agg_result;
+  ASSERT_EQ(OB_SUCCESS, data_agg_result.init(full_agg_metas_.count()));
+  ASSERT_EQ(OB_SUCCESS, table_agg_result.init(full_agg_metas_.count()));
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.init(full_agg_metas_, col_descs_, true, data_agg_result, allocator_));
+  ASSERT_EQ(OB_SUCCESS, table_aggregator.init(full_agg_metas_, col_descs_, true, table_agg_result, allocator_));
+
+  char sites[site_cnt][32];
+  ObStorageDatum block_filters[site_cnt];
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_count_));
+  for (int64_t i = 0; i < full_column_count_; ++i) {
+    row.storage_datums_[i].set_int(0);
+  }
+  char url[128];
+  int64_t max_filter_size = 0;
+  for (int64_t site = 0; site < site_cnt; ++site) {
+    snprintf(sites[site], sizeof(sites[site]), "%s%s", syllables[site / 8], syllables[site % 8]);
+    data_aggregator.reuse();
+    for (int64_t i = 0; i < rows_per_block; ++i) {
+      const int64_t page_id = site * rows_per_block + i;
+      const int64_t len = snprintf(url, sizeof(url), "https://www.%s.com/docs/page_%ld.html", sites[site], page_id);
+      row.storage_datums_[0].set_int(page_id);
+      row.storage_datums_[varchar_col_idx].set_string(url, len);
+      ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(row));
+      ASSERT_EQ(OB_SUCCESS, table_aggregator.eval(row));
+    }
+    const ObDatumRow *data_agg_row = nullptr;
+    ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+    ASSERT_FALSE(data_agg_row->storage_datums_[0].is_nop());
+    ASSERT_TRUE(ObSkipIndexBloomFilter::is_valid_size(data_agg_row->storage_datums_[0].len_));
+    ASSERT_EQ(OB_SUCCESS, block_filters[site].deep_copy(data_agg_row->storage_datums_[0], allocator_));
+    max_filter_size = MAX(max_filter_size, block_filters[site].len_);
+  }
+  // the fixed 128 bytes filter used before would be saturated by one micro block
+  ASSERT_GT(max_filter_size, 128);
+  // a filter of all the urls can prune nothing, so it is not stored
+  const ObDatumRow *table_agg_row = nullptr;
+  ASSERT_EQ(OB_SUCCESS, table_aggregator.get_aggregated_row(table_agg_row));
+  ASSERT_TRUE(table_agg_row->storage_datums_[0].is_nop());
+
+  int64_t checked_cnt = 0;
+  int64_t skipped_cnt = 0;
+  char pattern[64];
+  for (int64_t site = 0; site < site_cnt; ++site) {
+    const int64_t pattern_len = snprintf(pattern, sizeof(pattern), "%%www.%s.com/%%", sites[site]);
+    for (int64_t block = 0; block < site_cnt; ++block) {
+      const bool may_contain = ObSkipIndexBloomFilter::may_contain_like_pattern(
+          pattern, pattern_len, '\\', block_filters[block].ptr_, block_filters[block].len_);
+      if (block == site) {
+        // the micro block of the site must not be skipped
+        ASSERT_TRUE(may_contain) << "site: " << sites[site];
+      } else {
+        ++checked_cnt;
+        skipped_cnt += may_contain ? 0 : 1;
+      }
+    }
+  }
+  ASSERT_GE(skipped_cnt * 100, checked_cnt * 90) << "skipped: " << skipped_cnt << ", checked: " << checked_cnt;
+}
+
 }
 }
 
@@ -33,6 +33,7 @@
 #include "mtlenv/mock_tenant_module_env.h"
 #include "storage/blocksstable/index_block/ob_agg_row_struct.h"
 #include "storage/blocksstable/index_block/ob_skip_index_filter_executor.h"
+#include "storage/blocksstable/index_block/ob_index_block_util.h"
 #include "sql/engine/basic/ob_pushdown_filter.h"
 #include "ob_row_generate.h"
 
@@ -53,6 +54,7 @@ class TestSkipIndexFilter : public ::testing::Test
 public:
   static const int64_t ROWKEY_CNT = 2;
   static const int64_t COLUMN_CNT = ObExtendType - 1 + 7;
+  static const int64_t BLOOM_FILTER_SIZE = 128;
   TestSkipIndexFilter();
   virtual ~TestSkipIndexFilter();
   virtual void SetUp();
@@ -90,6 +92,14 @@ public:
     ObObj &max_obj,
     ObObj &null_count_obj,
     ObBoolMask &fal_desc);
+
+  // @bloom_filter is nullptr if bloom filter is not aggregated
+  int test_bloom_filter_pushdown(const uint64_t col_idx,
+    sql::ObPushdownWhiteFilterNode &filter_node,
+    common::ObFixedArray<ObObj, ObIAllocator> &filter_objs,
+    const char *bloom_filter,
+    ObBoolMask &fal_desc);
+  void build_bloom_filter(const ObObj *objs, const int64_t obj_cnt, char *bloom_filter);
 protected:
   ObRowGenerate row_generate_;
   common::ObArray<share::schema::ObColDesc> col_descs_;
@@ -402,6 +412,108 @@ int TestSkipIndexFilter::test_skip_index_filter_pushdown (
   return ret;
 }
 
+int TestSkipIndexFilter::test_bloom_filter_pushdown(
+    const uint64_t col_idx,
+    sql::ObPushdownWhiteFilterNode &filter_node,
+    common::ObFixedArray<ObObj, ObIAllocator> &filter_objs,
+    const char *bloom_filter,
+    ObBoolMask &fal_desc)
+{
+  int ret = OB_SUCCESS;
+  // genereate filter
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  sql::ObWhiteFilterExecutor filter(allocator_, filter_node, op);
+  filter.col_offsets_.init(COLUMN_CNT);
+  filter.col_params_.init(COLUMN_CNT);
+  const ObColumnParam *col_param = nullptr;
+  filter.col_params_.push_back(col_param);
+  filter.col_offsets_.push_back(col_idx);
+  filter.n_cols_ = 1;
+
+  const int count = filter_objs.count();
+  const ObWhiteFilterOperatorType op_type = filter_node.get_op_type();
+  int count_expr = WHITE_OP_IN == op_type ? count + 3 : count + 2;
+  int count_expr_p = WHITE_OP_IN == op_type ? count + 2 : count + 1;
+  sql::ObExpr *expr_buf = reinterpret_cast<sql::ObExpr *>(allocator_.alloc(sizeof(sql::ObExpr) * count_expr));
+  sql::ObExpr **expr_p_buf = reinterpret_cast<sql::ObExpr **>(allocator_.alloc(sizeof(sql::ObExpr*) * count_expr_p));
+  void *datum_buf = allocator_.alloc(sizeof(int8_t) * 128 * count);
+  ObDatum datums[count];
+  EXPECT_TRUE(OB_NOT_NULL(expr_buf));
+  EXPECT_TRUE(OB_NOT_NULL(expr_p_buf));
+
+  if (WHITE_OP_IN == op_type) {
+    init_in_filter(filter, filter_objs, expr_buf, expr_p_buf, datums, datum_buf);
+  } else {
+    init_filter(filter, filter_objs, expr_buf, expr_p_buf, datums, datum_buf);
+  }
+
+  // generate agg row with only the bloom filter
+  ObArray<ObSkipIndexColMeta> agg_cols;
+  ObDatumRow agg_row;
+  agg_row.init(1);
+  ObSkipIndexColMeta skip_col_meta;
+  skip_col_meta.col_idx_ = col_idx;
+  skip_col_meta.col_type_ = SK_IDX_BLOOM_FILTER;
+  agg_cols.push_back(skip_col_meta);
+  if (nullptr == bloom_filter) {
+    agg_row.storage_datums_[0].set_null();
+  } else {
+    agg_row.storage_datums_[0].set_string(bloom_filter, BLOOM_FILTER_SIZE);
+  }
+
+  ObAggRowWriter row_writer;
+  row_writer.init(agg_cols, agg_row, allocator_);
+  int64_t buf_size = row_writer.get_data_size();
+  char *buf = reinterpret_cast<char *>(allocator_.alloc(buf_size));
+  EXPECT_TRUE(buf != nullptr);
+  MEMSET(buf, 0, buf_size);
+  int64_t pos = 0;
+  row_writer.write_agg_data(buf, buf_size, pos);
+  EXPECT_TRUE(buf_size == pos);
+
+  ObMicroIndexInfo index_info;
+  ObIndexBlockRowHeader row_header;
+  ObSkipIndexFilterExecutor skip_index_filter;
+  row_header.row_count_ = row_count_;
+  index_info.agg_row_buf_ = buf;
+  index_info.agg_buf_size_ = buf_size;
+  index_info.row_header_ = &row_header;
+
+  ret = skip_index_filter.falsifiable_pushdown_filter(col_idx, filter.filter_.expr_->args_[0]->obj_meta_,
+      ObSkipIndexType::BLOOM_FILTER, index_info, filter, allocator_);
+  fal_desc = filter.get_filter_bool_mask();
+
+  if (nullptr != expr_buf) {
+    allocator_.free(expr_buf);
+  }
+  if (nullptr != expr_p_buf) {
+    allocator_.free(expr_p_buf);
+  }
+  if (nullptr != buf) {
+    allocator_.free(buf);
+  }
+  if (nullptr != datum_buf) {
+    allocator_.free(datum_buf);
+  }
+  return ret;
+}
+
+void TestSkipIndexFilter::build_bloom_filter(const ObObj *objs, const int64_t obj_cnt, char *bloom_filter)
+{
+  MEMSET(bloom_filter, 0, BLOOM_FILTER_SIZE);
+  for (int64_t i = 0; i < obj_cnt; ++i) {
+    ObDatum datum;
+    char datum_buf[128];
+    datum.ptr_ = datum_buf;
+    uint64_t hash = 0;
+    ASSERT_EQ(OB_SUCCESS, datum.from_obj(objs[i]));
+    ASSERT_EQ(OB_SUCCESS, ObSkipIndexBloomFilter::calc_hash(objs[i].get_meta(), datum, hash));
+    ObSkipIndexBloomFilter::insert(hash, bloom_filter, BLOOM_FILTER_SIZE);
+  }
+}
 
 TEST_F(TestSkipIndexFilter, test_eq)
 {
@@ -1422,6 +1534,155 @@ TEST_F(TestSkipIndexFilter, test_has_null)
 }
 
 
+TEST_F(TestSkipIndexFilter, test_bloom_filter)
+{
+  sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+  ObBoolMask fal_desc;
+  ObMalloc mallocer;
+  mallocer.set_label("SkipIndexFilter");
+  const int32_t col_idx = 0;
+  const int64_t value_cnt = 10;
+  const int64_t probe_cnt = 100;
+  char bloom_filter[BLOOM_FILTER_SIZE];
+
+  // a. integer column with values 0, 7, 14, ..., 63
+  ObObj values[value_cnt];
+  for (int64_t i = 0; i < value_cnt; ++i) {
+    values[i].set_int(i * 7);
+  }
+  build_bloom_filter(values, value_cnt, bloom_filter);
+  for (int64_t i = 0; i < value_cnt; ++i) {
+    // value in the block must not be skipped
+    ObFixedArray<ObObj, ObIAllocator> filter_objs(mallocer, 1);
+    OK(filter_objs.init(1));
+    OK(filter_objs.push_back(values[i]));
+    white_filter.op_type_ = sql::WHITE_OP_EQ;
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+    ASSERT_TRUE(fal_desc.is_uncertain());
+    // bloom filter can't prove always true
+    white_filter.op_type_ = sql::WHITE_OP_IN;
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+    ASSERT_TRUE(fal_desc.is_uncertain());
+  }
+  // values not in the block are skipped unless the bloom filter is false positive
+  int64_t eq_skipped_cnt = 0;
+  int64_t in_skipped_cnt = 0;
+  for (int64_t i = 0; i < probe_cnt; ++i) {
+    ObObj absent_obj;
+    absent_obj.set_int(1000 + i);
+    ObFixedArray<ObObj, ObIAllocator> filter_objs(mallocer, 3);
+    OK(filter_objs.init(3));
+    OK(filter_objs.push_back(absent_obj));
+    white_filter.op_type_ = sql::WHITE_OP_EQ;
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+    ASSERT_FALSE(fal_desc.is_always_true());
+    eq_skipped_cnt += fal_desc.is_always_false();
+
+    absent_obj.set_int(2000 + i);
+    OK(filter_objs.push_back(absent_obj));
+    white_filter.op_type_ = sql::WHITE_OP_IN;
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+    ASSERT_FALSE(fal_desc.is_always_true());
+    in_skipped_cnt += fal_desc.is_always_false();
+
+    // IN list with one value in the block must not be skipped
+    OK(filter_objs.push_back(values[i % value_cnt]));
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+    ASSERT_TRUE(fal_desc.is_uncertain());
+  }
+  ASSERT_GE(eq_skipped_cnt, probe_cnt * 9 / 10);
+  ASSERT_GE(in_skipped_cnt, probe_cnt * 9 / 10);
+
+  // b. null param and not aggregated bloom filter are left uncertain
+  {
+    ObFixedArray<ObObj, ObIAllocator> filter_objs(mallocer, 1);
+    OK(filter_objs.init(1));
+    ObObj null_obj;
+    null_obj.set_null();
+    OK(filter_objs.push_back(null_obj));
+    white_filter.op_type_ = sql::WHITE_OP_EQ;
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+    ASSERT_TRUE(fal_desc.is_uncertain());
+
+    ObFixedArray<ObObj, ObIAllocator> absent_objs(mallocer, 1);
+    OK(absent_objs.init(1));
+    ObObj absent_obj;
+    absent_obj.set_int(1000);
+    OK(absent_objs.push_back(absent_obj));
+    OK(test_bloom_filter_pushdown(col_idx, white_filter, absent_objs, nullptr, fal_desc));
+    ASSERT_TRUE(fal_desc.is_uncertain());
+  }
+
+  // c. string equal under case insensitive collation must get the same hash
+  {
+    const char *strs[] = {"oceanbase", "OceanBase_Docs", "skip index"};
+    ObObj str_values[3];
+    for (int64_t i = 0; i < 3; ++i) {
+      str_values[i].set_varchar(strs[i], static_cast<int32_t>(strlen(strs[i])));
+      str_values[i].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+      str_values[i].set_collation_level(CS_LEVEL_IMPLICIT);
+    }
+    build_bloom_filter(str_values, 3, bloom_filter);
+    const char *same_strs[] = {"OCEANBASE", "oceanbase_docs", "Skip Index"};
+    for (int64_t i = 0; i < 3; ++i) {
+      ObFixedArray<ObObj, ObIAllocator> filter_objs(mallocer, 1);
+      OK(filter_objs.init(1));
+      ObObj str_obj = str_values[i];
+      str_obj.set_varchar(same_strs[i], static_cast<int32_t>(strlen(same_strs[i])));
+      OK(filter_objs.push_back(str_obj));
+      white_filter.op_type_ = sql::WHITE_OP_EQ;
+      OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+      ASSERT_TRUE(fal_desc.is_uncertain());
+      white_filter.op_type_ = sql::WHITE_OP_IN;
+      OK(test_bloom_filter_pushdown(col_idx, white_filter, filter_objs, bloom_filter, fal_desc));
+      ASSERT_TRUE(fal_desc.is_uncertain());
+    }
+  }
+}
+
+TEST_F(TestSkipIndexFilter, test_ngram_bloom_filter_like_pattern)
+{
+  char bloom_filter[BLOOM_FILTER_SIZE];
+  MEMSET(bloom_filter, 0, sizeof(bloom_filter));
+  const char *strs[] = {"https://www.oceanbase.com/docs/page_1.html", "select * from t1 where c1 like 'a%'"};
+  for (int64_t i = 0; i < ARRAYSIZEOF(strs); ++i) {
+    const int64_t len = strlen(strs[i]);
+    for (int64_t j = 0; j + ObSkipIndexBloomFilter::NGRAM_SIZE <= len; ++j) {
+      ObSkipIndexBloomFilter::insert(ObSkipIndexBloomFilter::calc_ngram_hash(strs[i] + j), bloom_filter,
+          BLOOM_FILTER_SIZE);
+    }
+  }
+  struct {
+    const char *pattern_;
+    char escape_;
+    bool may_contain_;
+  } cases[] = {
+    // patterns matching the strings must not be skipped
+    {"https://www.oceanbase.com/docs/page_1.html", '\\', true},
+    {"%oceanbase%", '\\', true},
+    {"https://%/docs/%", '\\', true},
+    {"%ocean_base%", '\\', true},
+    {"%where c1 like 'a\\%'", '\\', true},
+    {"%where#_c1%", '#', true},
+    // no ngram in the pattern
+    {"", '\\', true},
+    {"%", '\\', true},
+    {"%ob%_%", '\\', true},
+    // escaped characters are segment boundaries, so this is not skipped though not matched
+    {"%page\\%1%", '\\', true},
+    // any literal segment with an absent ngram is skipped
+    {"%mysql%", '\\', false},
+    {"%oceanXbase%", '\\', false},
+    {"https://%/blog/%", '\\', false},
+    {"%docs#_xyz%", '#', false},
+  };
+  for (int64_t i = 0; i < ARRAYSIZEOF(cases); ++i) {
+    ASSERT_EQ(cases[i].may_contain_, ObSkipIndexBloomFilter::may_contain_like_pattern(
+        cases[i].pattern_, strlen(cases[i].pattern_), cases[i].escape_, bloom_filter, BLOOM_FILTER_SIZE))
+        << "pattern: " << cases[i].pattern_;
+  }
+}
+
 }//end namespace unittest
 }//end namespace oceanbase
 
@@ -135,6 +135,56 @@ public:
   }
 };
 
+// Selects the rows whose row id is not divisible by divisor_,
+// apply_filter fails if the iterator is not located to the range being filtered.
+class MockFilterCGIterator : public ObICGIterator
+{
+public:
+  explicit MockFilterCGIterator(const int64_t divisor) : divisor_(divisor), range_() {}
+  virtual ~MockFilterCGIterator() {}
+  virtual void reset() override { range_.reset(); }
+  virtual void reuse() override { range_.reset(); }
+  virtual int init(
+      const ObTableIterParam &iter_param,
+      ObTableAccessContext &access_ctx,
+      ObSSTableWrapper &wrapper) override
+  { return OB_SUCCESS; }
+  virtual int switch_context(
+      const ObTableIterParam &iter_param,
+      ObTableAccessContext &access_ctx,
+      ObSSTableWrapper &wrapper) override
+  { return OB_SUCCESS; }
+  virtual int locate(const ObCSRange &range, const ObCGBitmap *bitmap = nullptr) override
+  {
+    range_ = range;
+    return OB_SUCCESS;
+  }
+  virtual int apply_filter(
+      sql::ObPushdownFilterExecutor *parent,
+      sql::PushdownFilterInfo &filter_info,
+      const int64_t row_count,
+      const ObCGBitmap *parent_bitmap,
+      ObCGBitmap &result_bitmap) override
+  {
+    int ret = OB_SUCCESS;
+    if (range_.start_row_id_ != result_bitmap.get_start_id() || range_.get_row_count() != row_count) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Filter on the range which is not located", K(ret), K_(range),
+               K(result_bitmap.get_start_id()), K(row_count));
+    }
+    for (ObCSRowId row_id = range_.start_row_id_; OB_SUCC(ret) && row_id <= range_.end_row_id_; ++row_id) {
+      ret = result_bitmap.set(row_id, 0 != row_id % divisor_);
+    }
+    return ret;
+  }
+  virtual int get_next_rows(uint64_t &count, const uint64_t capacity) override { return OB_NOT_SUPPORTED; }
+  virtual ObCGIterType get_type() override { return OB_CG_SCANNER; }
+  TO_STRING_KV(K_(divisor), K_(range));
+public:
+  int64_t divisor_;
+  ObCSRange range_;
+};
+
 class TestCOSSTableRowsFilter : public ::testing::Test
 {
 public:
@@ -160,6 +210,7 @@ public:
   void init_multi_white_and_black_filter_case_one();
   void init_multi_white_and_black_filter_case_two();
   void reset_filter();
+  void check_adaptive_and_filter_result(const ObIArray<int64_t> &divisors);
   ObPushdownFilterExecutor* create_physical_filter(
       const ObSEArray<uint32_t, 4> &_cg_idxes,
       bool is_white);
@@ -439,6 +490,40 @@ void TestCOSSTableRowsFilter::reset_filter()
   co_filter_.reset();
 }
 
+// apply the filter on several ranges and check the result is AND of all children,
+// the filter iters are mocked with divisors by the order of iter idx
+void TestCOSSTableRowsFilter::check_adaptive_and_filter_result(const ObIArray<int64_t> &divisors)
+{
+  ObIAllocator *allocator_ptr = &allocator_;
+  for (int64_t i = 0; i < divisors.count(); ++i) {
+    MockFilterCGIterator *cg_iter = OB_NEWx(MockFilterCGIterator, allocator_ptr, divisors.at(i));
+    ASSERT_NE(nullptr, cg_iter);
+    ASSERT_EQ(OB_SUCCESS, co_filter_.filter_iters_.push_back(cg_iter));
+  }
+  ASSERT_EQ(OB_SUCCESS, co_filter_.init_bitmap_buffer(3));
+  ASSERT_EQ(OB_SUCCESS, co_filter_.init_adaptive_and_filters(filter_));
+  ASSERT_EQ(1, co_filter_.adaptive_and_filters_.count());
+  co_filter_.is_inited_ = true;
+  const int64_t row_cnt = 64;
+  for (int64_t range_idx = 0; range_idx < 3 * ObCOSSTableRowsFilter::ObAdaptiveAndFilter::REORDER_INTERVAL; ++range_idx) {
+    ObCSRange range(range_idx * row_cnt, row_cnt);
+    ASSERT_EQ(OB_SUCCESS, co_filter_.apply(range));
+    const ObCGBitmap *result = co_filter_.get_result_bitmap();
+    ASSERT_NE(nullptr, result);
+    ASSERT_EQ(range.start_row_id_, result->get_start_id());
+    for (ObCSRowId row_id = range.start_row_id_; row_id <= range.end_row_id_; ++row_id) {
+      bool expected = true;
+      for (int64_t i = 0; i < divisors.count(); ++i) {
+        expected = expected && 0 != row_id % divisors.at(i);
+      }
+      ASSERT_EQ(expected, result->test(row_id)) << "row_id: " << row_id;
+    }
+  }
+  // the children are reordered by pass ratio, the most selective one first
+  const ObCOSSTableRowsFilter::ObAdaptiveAndFilter &adaptive_filter = co_filter_.adaptive_and_filters_.at(0);
+  ASSERT_EQ(adaptive_filter.child_cnt_ - 1, adaptive_filter.order_[0]);
+}
+
 TEST_F(TestCOSSTableRowsFilter, co_sstable_rows_filter_test_init)
 {
   int ret = OB_SUCCESS;
@@ -555,6 +640,94 @@ TEST_F(TestCOSSTableRowsFilter, co_sstable_rows_filter_test_rewrite_filter_case_
   reset_filter();
 }
 
+TEST_F(TestCOSSTableRowsFilter, co_sstable_rows_filter_test_adaptive_and_filter)
+{
+  ObCOSSTableRowsFilter::ObAdaptiveAndFilter adaptive_filter;
+  adaptive_filter.child_cnt_ = 3;
+  for (uint32_t i = 0; i < ObCOSSTableRowsFilter::ObAdaptiveAndFilter::REORDER_INTERVAL - 1; ++i) {
+    adaptive_filter.add_stat(0, 1000, 900);
+    adaptive_filter.add_stat(1, 900, 9);
+    adaptive_filter.add_stat(2, 9, 3);
+    adaptive_filter.try_reorder();
+  }
+  // not reordered before REORDER_INTERVAL batches
+  ASSERT_EQ(0, adaptive_filter.order_[0]);
+  ASSERT_EQ(1, adaptive_filter.order_[1]);
+  ASSERT_EQ(2, adaptive_filter.order_[2]);
+
+  adaptive_filter.try_reorder();
+  ASSERT_EQ(1, adaptive_filter.order_[0]);
+  ASSERT_EQ(2, adaptive_filter.order_[1]);
+  ASSERT_EQ(0, adaptive_filter.order_[2]);
+  // stat decays after reorder
+  ASSERT_EQ(900 * 7 / 2, adaptive_filter.input_cnts_[1]);
+
+  // child without stat keeps behind the measured ones
+  adaptive_filter.input_cnts_[1] = 0;
+  adaptive_filter.output_cnts_[1] = 0;
+  for (uint32_t i = 0; i < ObCOSSTableRowsFilter::ObAdaptiveAndFilter::REORDER_INTERVAL; ++i) {
+    adaptive_filter.try_reorder();
+  }
+  ASSERT_EQ(2, adaptive_filter.order_[0]);
+  ASSERT_EQ(0, adaptive_filter.order_[1]);
+  ASSERT_EQ(1, adaptive_filter.order_[2]);
+}
+
+TEST_F(TestCOSSTableRowsFilter, co_sstable_rows_filter_test_adaptive_and_filter_result)
+{
+  init_all();
+  // coprime divisors make the pass ratios of children independent, the last child is the most selective
+  const int64_t primes[] = {7, 5, 3, 2};
+  // AND(c0, c1, c2, c3)
+  {
+    const int64_t child_cnt = 4;
+    ObSEArray<int64_t, 8> divisors;
+    filter_ = create_logical_filter(true);
+    ObPushdownFilterExecutor **childs = new ObPushdownFilterExecutor*[child_cnt];
+    for (int64_t i = 0; i < child_cnt; ++i) {
+      ObSEArray<uint32_t, 4> cg_idxes;
+      cg_idxes.push_back(i + 1);
+      childs[i] = create_physical_filter(cg_idxes, true);
+      childs[i]->set_cg_iter_idx(i);
+      ASSERT_EQ(OB_SUCCESS, divisors.push_back(primes[i]));
+    }
+    filter_->set_childs(child_cnt, childs);
+    co_filter_.filter_ = filter_;
+    co_filter_.allocator_ = &allocator_;
+    check_adaptive_and_filter_result(divisors);
+    reset_filter();
+  }
+  // AND(c0, c1, AND(c2, c3, c4, c5)), only the nested AND is adaptive
+  {
+    const int64_t sub_child_cnt = 4;
+    ObSEArray<int64_t, 8> divisors;
+    filter_ = create_logical_filter(true);
+    ObPushdownFilterExecutor **childs = new ObPushdownFilterExecutor*[3];
+    for (int64_t i = 0; i < 2; ++i) {
+      ObSEArray<uint32_t, 4> cg_idxes;
+      cg_idxes.push_back(i + 1);
+      childs[i] = create_physical_filter(cg_idxes, true);
+      childs[i]->set_cg_iter_idx(i);
+      ASSERT_EQ(OB_SUCCESS, divisors.push_back(11 + 2 * i));
+    }
+    childs[2] = create_logical_filter(true);
+    ObPushdownFilterExecutor **sub_childs = new ObPushdownFilterExecutor*[sub_child_cnt];
+    for (int64_t i = 0; i < sub_child_cnt; ++i) {
+      ObSEArray<uint32_t, 4> cg_idxes;
+      cg_idxes.push_back(i + 3);
+      sub_childs[i] = create_physical_filter(cg_idxes, true);
+      sub_childs[i]->set_cg_iter_idx(i + 2);
+      ASSERT_EQ(OB_SUCCESS, divisors.push_back(primes[i]));
+    }
+    childs[2]->set_childs(sub_child_cnt, sub_childs);
+    filter_->set_childs(3, childs);
+    co_filter_.filter_ = filter_;
+    co_filter_.allocator_ = &allocator_;
+    check_adaptive_and_filter_result(divisors);
+    reset_filter();
+  }
+}
+
 } //namespace unittest
 } //namespace oceanbase
 
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "storage/memtable/ob_lock_wait_mgr.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::memtable;
+using namespace oceanbase::transaction;
+using namespace oceanbase::transaction::tablelock;
+
+TEST(TestLockWaitQueueHeadChecker, row_queue_head)
+{
+  LockWaitQueueHeadChecker checker;
+  // row hashes have the two highest bits unset
+  const uint64_t row_hash = 1001;
+  const uint64_t other_row_hash = 1003;
+  ASSERT_TRUE(LockHashHelper::is_rowkey_hash(row_hash));
+  ASSERT_TRUE(LockHashHelper::is_rowkey_hash(other_row_hash));
+
+  // the first waiter has no session and keeps waiting, it can not take the row
+  ASSERT_TRUE(checker.is_queue_head(row_hash));
+  checker.on_checked(row_hash, false);
+  // the second waiter is popped because of timeout, it can not take the row either
+  ASSERT_TRUE(checker.is_queue_head(row_hash));
+  checker.on_checked(row_hash, false);
+  // the third waiter keeps waiting on a session, it is the head
+  ASSERT_TRUE(checker.is_queue_head(row_hash));
+  checker.on_checked(row_hash, true);
+  // the waiters behind the head are not
+  ASSERT_FALSE(checker.is_queue_head(row_hash));
+  checker.on_checked(row_hash, true);
+  ASSERT_FALSE(checker.is_queue_head(row_hash));
+  checker.on_checked(row_hash, false);
+  ASSERT_FALSE(checker.is_queue_head(row_hash));
+
+  // the first waiter on the next row is popped to retry the lock, it is the head
+  ASSERT_TRUE(checker.is_queue_head(other_row_hash));
+  checker.on_checked(other_row_hash, true);
+  ASSERT_FALSE(checker.is_queue_head(other_row_hash));
+}
+
+TEST(TestLockWaitQueueHeadChecker, tx_and_table_lock_queue)
+{
+  LockWaitQueueHeadChecker checker;
+  ObTransID tx_id(1001);
+  ObLockID lock_id;
+  ASSERT_EQ(OB_SUCCESS, lock_id.set(ObLockOBJType::OBJ_TYPE_TABLE, 1001));
+  const uint64_t tx_hash = LockHashHelper::hash_trans(tx_id);
+  const uint64_t lock_hash = LockHashHelper::hash_lock_id(lock_id);
+
+  // all the waiters on a transaction or a table lock are woken up together
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_TRUE(checker.is_queue_head(tx_hash));
+    checker.on_checked(tx_hash, true);
+  }
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_TRUE(checker.is_queue_head(lock_hash));
+    checker.on_checked(lock_hash, true);
+  }
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_lock_wait_mgr.log*");
+  oceanbase::common::ObLogger::get_logger().set_file_name("test_lock_wait_mgr.log", true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
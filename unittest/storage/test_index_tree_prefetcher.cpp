@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "lib/oblog/ob_log_module.h"
+#include "storage/access/ob_index_tree_prefetcher.h"
+namespace oceanbase
+{
+
+using namespace common;
+using namespace storage;
+
+typedef ObIndexTreeMultiPassPrefetcher<> TestPrefetcher;
+
+void check_prefetch_depth(TestPrefetcher &prefetcher, const int64_t *expected_depths, const int64_t cnt)
+{
+  int64_t depth = 0;
+  for (int64_t i = 0; i < cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, prefetcher.get_prefetch_depth(depth));
+    ASSERT_EQ(expected_depths[i], prefetcher.prefetch_depth_) << "round: " << i;
+    ASSERT_EQ(expected_depths[i], depth) << "round: " << i;
+  }
+}
+
+TEST(TestIndexTreePrefetcher, prefetch_depth)
+{
+  TestPrefetcher prefetcher;
+  prefetcher.max_micro_handle_cnt_ = TestPrefetcher::DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT;
+  prefetcher.cur_micro_data_fetch_idx_ = 0;
+  prefetcher.micro_data_prefetch_idx_ = 0;
+
+  // cold scan doubles the depth up to the handle count
+  const int64_t cold_depths[] = {2, 4, 8, 16, 32, 32};
+  check_prefetch_depth(prefetcher, cold_depths, ARRAYSIZEOF(cold_depths));
+
+  // hot scan halves the depth down to HOT_SCAN_PREFETCH_DEPTH
+  prefetcher.is_hot_prefetch_ = true;
+  const int64_t hot_depths[] = {16, 8, 4, 4};
+  check_prefetch_depth(prefetcher, hot_depths, ARRAYSIZEOF(hot_depths));
+
+  // hot rescan starts from depth 1 and grows no faster than a cold scan
+  prefetcher.prefetch_depth_ = 1;
+  const int64_t hot_rescan_depths[] = {2, 4, 4};
+  check_prefetch_depth(prefetcher, hot_rescan_depths, ARRAYSIZEOF(hot_rescan_depths));
+
+  // io comes back, the depth grows again
+  prefetcher.is_hot_prefetch_ = false;
+  const int64_t warm_depths[] = {8, 16};
+  check_prefetch_depth(prefetcher, warm_depths, ARRAYSIZEOF(warm_depths));
+}
+
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_index_tree_prefetcher.log*");
+  OB_LOGGER.set_file_name("test_index_tree_prefetcher.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
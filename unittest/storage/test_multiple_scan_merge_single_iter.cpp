@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2024 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/access/ob_multiple_scan_merge.h"
+#include "lib/allocator/page_arena.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+using namespace blocksstable;
+
+namespace unittest
+{
+static const int64_t NOP_VAL = INT64_MIN;
+
+struct MockRow
+{
+  int64_t pk_;
+  int64_t val_;
+  ObDmlFlag flag_;
+};
+
+class ObMockDatumRowIterator : public ObStoreRowIterator
+{
+public:
+  ObMockDatumRowIterator() : rows_(), cur_idx_(0) {}
+  virtual ~ObMockDatumRowIterator() {}
+  virtual int get_next_row(const ObDatumRow *&row) override
+  {
+    int ret = OB_SUCCESS;
+    if (cur_idx_ >= rows_.count()) {
+      ret = OB_ITER_END;
+    } else {
+      row = rows_.at(cur_idx_++);
+    }
+    return ret;
+  }
+public:
+  ObSEArray<ObDatumRow *, 16> rows_;
+  int64_t cur_idx_;
+};
+
+class TestMultipleScanMergeSingleIter : public ::testing::Test
+{
+public:
+  static const int64_t ROWKEY_CNT = 1;
+  static const int64_t COLUMN_CNT = 2;
+public:
+  TestMultipleScanMergeSingleIter() : allocator_(ObModIds::TEST) {}
+  virtual ~TestMultipleScanMergeSingleIter() {}
+  virtual void SetUp();
+  virtual void TearDown();
+  void prepare_iter(const MockRow *rows, const int64_t row_cnt, ObIArray<ObMockDatumRowIterator *> &iters);
+  // iters.at(0) is the newest one, the same as the iters of ObMultipleScanMerge
+  void scan(
+      ObIArray<ObMockDatumRowIterator *> &iters,
+      const bool iter_del_row,
+      ObMultipleScanMerge &merge,
+      ObIArray<MockRow> &result);
+  void check_result(const ObIArray<MockRow> &expect, const ObIArray<MockRow> &result);
+public:
+  ObArenaAllocator allocator_;
+  ObStorageDatumUtils datum_utils_;
+  ObTableAccessParam access_param_;
+  ObTableAccessContext access_ctx_;
+};
+
+void TestMultipleScanMergeSingleIter::SetUp()
+{
+  ObSEArray<share::schema::ObColDesc, COLUMN_CNT> col_descs;
+  for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+    share::schema::ObColDesc col_desc;
+    col_desc.col_id_ = OB_APP_MIN_COLUMN_ID + i;
+    col_desc.col_type_.set_int();
+    ASSERT_EQ(OB_SUCCESS, col_descs.push_back(col_desc));
+  }
+  ASSERT_EQ(OB_SUCCESS, datum_utils_.init(col_descs, ROWKEY_CNT, false, allocator_));
+}
+
+void TestMultipleScanMergeSingleIter::TearDown()
+{
+  datum_utils_.reset();
+  allocator_.reset();
+}
+
+void TestMultipleScanMergeSingleIter::prepare_iter(
+    const MockRow *rows,
+    const int64_t row_cnt,
+    ObIArray<ObMockDatumRowIterator *> &iters)
+{
+  ObMockDatumRowIterator *iter = OB_NEWx(ObMockDatumRowIterator, &allocator_);
+  ASSERT_NE(nullptr, iter);
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ObDatumRow *row = OB_NEWx(ObDatumRow, &allocator_);
+    ASSERT_NE(nullptr, row);
+    ASSERT_EQ(OB_SUCCESS, row->init(allocator_, COLUMN_CNT));
+    row->count_ = COLUMN_CNT;
+    row->row_flag_.set_flag(rows[i].flag_);
+    row->storage_datums_[0].set_int(rows[i].pk_);
+    if (NOP_VAL == rows[i].val_) {
+      row->storage_datums_[1].set_nop();
+    } else {
+      row->storage_datums_[1].set_int(rows[i].val_);
+    }
+    ASSERT_EQ(OB_SUCCESS, iter->rows_.push_back(row));
+  }
+  ASSERT_EQ(OB_SUCCESS, iters.push_back(iter));
+}
+
+void TestMultipleScanMergeSingleIter::scan(
+    ObIArray<ObMockDatumRowIterator *> &iters,
+    const bool iter_del_row,
+    ObMultipleScanMerge &merge,
+    ObIArray<MockRow> &result)
+{
+  int ret = OB_SUCCESS;
+  merge.access_param_ = &access_param_;
+  merge.access_ctx_ = &access_ctx_;
+  merge.long_life_allocator_ = &allocator_;
+  merge.set_iter_del_row(iter_del_row);
+  ASSERT_EQ(OB_SUCCESS, merge.nop_pos_.init(allocator_, COLUMN_CNT));
+  ASSERT_EQ(OB_SUCCESS, merge.tree_cmp_.init(ROWKEY_CNT, datum_utils_, false));
+  for (int64_t i = 0; i < iters.count(); ++i) {
+    ASSERT_EQ(OB_SUCCESS, merge.iters_.push_back(iters.at(i)));
+  }
+  ASSERT_EQ(OB_SUCCESS, merge.set_rows_merger(iters.count()));
+  // all the iters are consumers before the first row, the same as construct_iters
+  merge.consumer_cnt_ = 0;
+  for (int64_t i = iters.count() - 1; i >= 0; --i) {
+    merge.consumers_[merge.consumer_cnt_++] = i;
+  }
+
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COLUMN_CNT));
+  while (OB_SUCC(merge.inner_get_next_row(row))) {
+    MockRow mock_row;
+    mock_row.pk_ = row.storage_datums_[0].get_int();
+    mock_row.val_ = row.storage_datums_[1].is_nop() ? NOP_VAL : row.storage_datums_[1].get_int();
+    mock_row.flag_ = row.row_flag_.get_dml_flag();
+    ASSERT_EQ(OB_SUCCESS, result.push_back(mock_row));
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+}
+
+void TestMultipleScanMergeSingleIter::check_result(const ObIArray<MockRow> &expect, const ObIArray<MockRow> &result)
+{
+  ASSERT_EQ(expect.count(), result.count());
+  for (int64_t i = 0; i < expect.count(); ++i) {
+    ASSERT_EQ(expect.at(i).pk_, result.at(i).pk_) << "row idx: " << i;
+    ASSERT_EQ(expect.at(i).val_, result.at(i).val_) << "row idx: " << i;
+    ASSERT_EQ(expect.at(i).flag_, result.at(i).flag_) << "row idx: " << i;
+  }
+}
+
+// rows of the base iter are shadowed by the newer iters on 3, 5, 7 and 12, the rows after 15 are
+// only in the base iter and are returned by the single consumer path once the newer iters end
+static const MockRow BASE_ROWS[] = {
+  {1, 10, DF_INSERT}, {2, 20, DF_INSERT}, {3, 30, DF_INSERT}, {4, 40, DF_INSERT},
+  {5, 50, DF_INSERT}, {6, 60, DF_INSERT}, {7, 70, DF_INSERT}, {8, 80, DF_INSERT},
+  {9, 90, DF_INSERT}, {10, 100, DF_INSERT}, {16, 160, DF_INSERT}, {17, 170, DF_INSERT},
+  {18, NOP_VAL, DF_DELETE}, {19, 190, DF_INSERT}
+};
+static const MockRow MIDDLE_ROWS[] = {
+  {3, 333, DF_UPDATE}, {5, NOP_VAL, DF_DELETE}, {12, 120, DF_INSERT}
+};
+static const MockRow NEWEST_ROWS[] = {
+  {3, NOP_VAL, DF_DELETE}, {5, 555, DF_INSERT}, {7, NOP_VAL, DF_UPDATE},
+  {12, NOP_VAL, DF_DELETE}, {15, NOP_VAL, DF_DELETE}
+};
+// the fused rows of the three iters above
+static const MockRow FUSED_ROWS[] = {
+  {1, 10, DF_INSERT}, {2, 20, DF_INSERT}, {3, NOP_VAL, DF_DELETE}, {4, 40, DF_INSERT},
+  {5, 555, DF_INSERT}, {6, 60, DF_INSERT}, {7, 70, DF_UPDATE}, {8, 80, DF_INSERT},
+  {9, 90, DF_INSERT}, {10, 100, DF_INSERT}, {12, NOP_VAL, DF_DELETE}, {15, NOP_VAL, DF_DELETE},
+  {16, 160, DF_INSERT}, {17, 170, DF_INSERT}, {18, NOP_VAL, DF_DELETE}, {19, 190, DF_INSERT}
+};
+static const int64_t FUSED_DELETE_CNT = 4;
+
+TEST_F(TestMultipleScanMergeSingleIter, test_single_iter_vs_multiple_iters)
+{
+  for (int64_t i = 0; i < 2; ++i) {
+    const bool iter_del_row = (1 == i);
+    ObSEArray<ObMockDatumRowIterator *, 3> multiple_iters;
+    prepare_iter(NEWEST_ROWS, ARRAYSIZEOF(NEWEST_ROWS), multiple_iters);
+    prepare_iter(MIDDLE_ROWS, ARRAYSIZEOF(MIDDLE_ROWS), multiple_iters);
+    prepare_iter(BASE_ROWS, ARRAYSIZEOF(BASE_ROWS), multiple_iters);
+    ObSEArray<ObMockDatumRowIterator *, 1> single_iters;
+    prepare_iter(FUSED_ROWS, ARRAYSIZEOF(FUSED_ROWS), single_iters);
+
+    ObSEArray<MockRow, 16> expect;
+    for (int64_t j = 0; j < ARRAYSIZEOF(FUSED_ROWS); ++j) {
+      if (iter_del_row || DF_DELETE != FUSED_ROWS[j].flag_) {
+        ASSERT_EQ(OB_SUCCESS, expect.push_back(FUSED_ROWS[j]));
+      }
+    }
+
+    ObMultipleScanMerge multiple_merge;
+    ObSEArray<MockRow, 16> multiple_result;
+    scan(multiple_iters, iter_del_row, multiple_merge, multiple_result);
+    check_result(expect, multiple_result);
+
+    ObMultipleScanMerge single_merge;
+    ObSEArray<MockRow, 16> single_result;
+    scan(single_iters, iter_del_row, single_merge, single_result);
+    check_result(expect, single_result);
+    // all the rows of the single iter are returned without the rows merger
+    ASSERT_EQ(0, single_merge.row_stat_.inc_row_count_);
+    ASSERT_EQ(expect.count(), single_merge.row_stat_.base_row_count_);
+    ASSERT_EQ(iter_del_row ? 0 : FUSED_DELETE_CNT, single_merge.row_stat_.filt_del_count_);
+  }
+}
+
+TEST_F(TestMultipleScanMergeSingleIter, test_empty_newer_iters)
+{
+  for (int64_t i = 0; i < 2; ++i) {
+    const bool iter_del_row = (1 == i);
+    // the newer iters have no rows, so the base iter becomes the single consumer at the first row
+    ObSEArray<ObMockDatumRowIterator *, 3> multiple_iters;
+    prepare_iter(nullptr, 0, multiple_iters);
+    prepare_iter(nullptr, 0, multiple_iters);
+    prepare_iter(BASE_ROWS, ARRAYSIZEOF(BASE_ROWS), multiple_iters);
+    ObSEArray<ObMockDatumRowIterator *, 1> single_iters;
+    prepare_iter(BASE_ROWS, ARRAYSIZEOF(BASE_ROWS), single_iters);
+
+    ObMultipleScanMerge multiple_merge;
+    ObSEArray<MockRow, 16> multiple_result;
+    scan(multiple_iters, iter_del_row, multiple_merge, multiple_result);
+    ObMultipleScanMerge single_merge;
+    ObSEArray<MockRow, 16> single_result;
+    scan(single_iters, iter_del_row, single_merge, single_result);
+    check_result(single_result, multiple_result);
+    ASSERT_EQ(ARRAYSIZEOF(BASE_ROWS) - (iter_del_row ? 0 : 1), single_result.count());
+  }
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_multiple_scan_merge_single_iter.log*");
+  OB_LOGGER.set_file_name("test_multiple_scan_merge_single_iter.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/net/ob_addr.h"
+#include "storage/tx/ob_gts_source.h"
+#include "storage/tx/ob_gts_rpc.h"
+#include "storage/tx/ob_location_adapter.h"
+#include "storage/tx/ob_ts_mgr.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace transaction;
+namespace unittest
+{
+
+class MyGtsRequestRpc : public ObIGtsRequestRpc
+{
+public:
+  MyGtsRequestRpc() : post_cnt_(0) {}
+  ~MyGtsRequestRpc() {}
+  int start() { return OB_SUCCESS; }
+  int stop() { return OB_SUCCESS; }
+  int wait() { return OB_SUCCESS; }
+  void destroy() {}
+public:
+  int post(const uint64_t tenant_id, const ObAddr &server, const ObGtsRequest &msg)
+  {
+    UNUSED(tenant_id);
+    UNUSED(server);
+    // the request is never responded, the test delivers the response by hand
+    post_cnt_++;
+    last_srr_ = msg.get_srr();
+    return OB_SUCCESS;
+  }
+public:
+  int64_t post_cnt_;
+  MonotonicTs last_srr_;
+};
+
+class MyLocationAdapter : public ObILocationAdapter
+{
+public:
+  MyLocationAdapter() {}
+  ~MyLocationAdapter() {}
+  int init(share::schema::ObMultiVersionSchemaService *schema_service,
+           share::ObLocationService *location_service)
+  {
+    UNUSED(schema_service);
+    UNUSED(location_service);
+    return OB_SUCCESS;
+  }
+  void destroy() {}
+public:
+  int nonblock_get_leader(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id,
+                          ObAddr &leader)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    leader = leader_;
+    return OB_SUCCESS;
+  }
+  int nonblock_renew(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    return OB_SUCCESS;
+  }
+  int nonblock_get(const int64_t cluster_id, const int64_t tenant_id, const ObLSID &ls_id,
+                   ObLSLocation &location)
+  {
+    UNUSED(cluster_id);
+    UNUSED(tenant_id);
+    UNUSED(ls_id);
+    UNUSED(location);
+    return OB_NOT_SUPPORTED;
+  }
+public:
+  ObAddr leader_;
+};
+
+class MyTsCbTask : public ObTsCbTask
+{
+public:
+  MyTsCbTask() : hash_(0) {}
+  ~MyTsCbTask() {}
+  int gts_callback_interrupted(const int errcode, const ObLSID ls_id)
+  {
+    UNUSED(errcode);
+    UNUSED(ls_id);
+    return OB_SUCCESS;
+  }
+  int get_gts_callback(const MonotonicTs srr, const SCN &gts, const MonotonicTs receive_gts_ts)
+  {
+    UNUSED(srr);
+    UNUSED(gts);
+    UNUSED(receive_gts_ts);
+    return OB_SUCCESS;
+  }
+  int gts_elapse_callback(const MonotonicTs srr, const SCN &gts)
+  {
+    UNUSED(srr);
+    UNUSED(gts);
+    return OB_SUCCESS;
+  }
+  MonotonicTs get_stc() const { return MonotonicTs::current_time(); }
+  uint64_t hash() const { return hash_; }
+  uint64_t get_tenant_id() const { return 1001; }
+public:
+  uint64_t hash_;
+};
+
+class TestObGtsSource : public ::testing::Test
+{
+public:
+  static const int64_t TASK_CNT = 16;
+  virtual void SetUp()
+  {
+    const uint64_t tenant_id = 1001;
+    ObAddr self(ObAddr::IPV4, "127.0.0.1", 8888);
+    location_adapter_.leader_.set_ip_addr("127.0.0.2", 8888);
+    for (int64_t i = 0; i < TASK_CNT; ++i) {
+      tasks_[i].hash_ = i;
+    }
+    EXPECT_EQ(OB_SUCCESS, gts_source_.init(tenant_id, self, &rpc_, &location_adapter_));
+  }
+  virtual void TearDown()
+  {
+    gts_source_.destroy();
+  }
+  // deliver the response of the last request like ObGtsResponseRpc does
+  void respond_last_request(const int64_t gts)
+  {
+    bool update = false;
+    EXPECT_EQ(OB_SUCCESS, gts_source_.update_gts(rpc_.last_srr_, gts, MonotonicTs::current_time(), update));
+  }
+public:
+  MyTsCbTask tasks_[TASK_CNT];
+  MyGtsRequestRpc rpc_;
+  MyLocationAdapter location_adapter_;
+  ObGtsSource gts_source_;
+};
+
+TEST_F(TestObGtsSource, waiting_tasks_share_one_request)
+{
+  int64_t gts = 0;
+  // the tasks queued while a request is on the road are handled by its response
+  for (int64_t i = 0; i < TASK_CNT; ++i) {
+    EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(&tasks_[i], gts));
+  }
+  EXPECT_EQ(1, rpc_.post_cnt_);
+  EXPECT_EQ(TASK_CNT - 1, gts_source_.gts_statistics_.coalesced_gts_rpc_cnt_);
+  EXPECT_FALSE(gts_source_.gts_local_cache_.no_rpc_on_road());
+
+  // a new request is sent for the tasks waiting for a larger gts after the response arrives
+  respond_last_request(100);
+  EXPECT_TRUE(gts_source_.gts_local_cache_.no_rpc_on_road());
+  bool need_wait = false;
+  for (int64_t i = 0; i < TASK_CNT; ++i) {
+    EXPECT_EQ(OB_SUCCESS, gts_source_.wait_gts_elapse(200, &tasks_[i], need_wait));
+    EXPECT_TRUE(need_wait);
+  }
+  EXPECT_EQ(2, rpc_.post_cnt_);
+  EXPECT_EQ(2 * (TASK_CNT - 1), gts_source_.gts_statistics_.coalesced_gts_rpc_cnt_);
+}
+
+TEST_F(TestObGtsSource, resend_lost_request)
+{
+  int64_t gts = 0;
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(&tasks_[0], gts));
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(&tasks_[1], gts));
+  EXPECT_EQ(1, rpc_.post_cnt_);
+
+  // the request which is not responded in time is considered lost
+  ob_usleep(ObGtsSource::GTS_RPC_ON_ROAD_TIMEOUT_US + 1000);
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(&tasks_[2], gts));
+  EXPECT_EQ(2, rpc_.post_cnt_);
+  EXPECT_EQ(OB_EAGAIN, gts_source_.get_gts(&tasks_[3], gts));
+  EXPECT_EQ(2, rpc_.post_cnt_);
+
+  // the response of the resent request makes the gts cache usable
+  respond_last_request(100);
+  EXPECT_EQ(OB_SUCCESS, gts_source_.get_gts(&tasks_[4], gts));
+  EXPECT_EQ(100, gts);
+  EXPECT_EQ(2, rpc_.post_cnt_);
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_source.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}